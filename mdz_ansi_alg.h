@@ -18,6 +18,11 @@
  * \par portability
  * Source code of library conforms to ANSI C 89/90 Standard.
  *
+ * \par thread-safety
+ * mdz_ansi_alg_init() should be called once, before any other function of the library is called from other threads. After successful initialization functions may be called concurrently from many threads, with following limitation. Memory which is modified by a function (string, buffer, context) should not be accessed by other threads during that call; memory which is only read (like data searched, or trie/hash/block/filter built in pBuffer) may be shared by any number of threads.
+ * Limitation of 0.3 binaries: mdz_ansi_alg_find(), mdz_ansi_alg_rfind(), mdz_ansi_alg_count() and mdz_ansi_alg_replace() with search area (nRightPos - nLeftPos) bigger than 90000000 bytes, and mdz_ansi_alg_firstOf(), mdz_ansi_alg_firstNotOf(), mdz_ansi_alg_lastOf() and mdz_ansi_alg_lastNotOf() with such search area and nCount bigger than 5, validate license again. Validation uses shared static memory of library and, if it fails, resets license state for all threads. Such calls are not thread-safe: caller should serialize them (for example with mutex), or split search area into parts of at most 90000000 bytes. Other functions and calls with smaller search area only read license state and may be called concurrently.
+ * Exception: mdz_ansi_alg_setSimd() changes level of SIMD instructions for the whole process, thus like mdz_ansi_alg_init() it should be called before library functions are used from other threads.
+ *
  * \version 0.1
  *
  * \date 2024-09
@@ -28,12 +33,74 @@
 #define MDZ_ANSI_ALG_H
 
 #include <stddef.h>
+#include <limits.h>
 
 #include "mdz_bool.h"
 #include "mdz_ansi_compare_result.h"
 #include "mdz_ansi_replace_type.h"
+#include "mdz_ansi_diff_type.h"
+#include "mdz_ansi_offsets_encoding.h"
+#include "mdz_ansi_simd.h"
 #include "mdz_error.h"
 
+/**
+ * Minor version of library binaries used with this header: 3 for 0.3 binaries. Functions added after release 0.3 are declared only if MDZ_ANSI_ALG_VERSION is defined as 4 or bigger before this header is included, and should be used only with binaries of release 0.4 or newer, which export them
+ */
+#ifndef MDZ_ANSI_ALG_VERSION
+#define MDZ_ANSI_ALG_VERSION 3
+#endif
+
+#if MDZ_ANSI_ALG_VERSION >= 4
+/**
+ * Recommended alignment in bytes of processed data, that is of address pcData + nLeftPos. This is a contract for future SIMD kernels, which may skip alignment prologue for such data; current binaries contain no SIMD code, thus alignment does not change their speed. Buffer prepared with mdz_ansi_alg_alignBuffer() has this alignment
+ */
+#define MDZ_ANSI_ALG_ALIGNMENT 64
+
+/**
+ * Number of readable bytes, which caller guarantees after processed data for *Padded functions. Buffer prepared with mdz_ansi_alg_alignBuffer() has this padding after 0-terminator
+ */
+#define MDZ_ANSI_ALG_PADDING 64
+
+/**
+ * Number of bits in word of bitmap, written by mdz_ansi_alg_findSingleBitmap() or mdz_ansi_alg_firstOfBitmap(). Bit i of bitmap is bit (i % MDZ_ANSI_ALG_BITMAP_WORD_BITS) of word (i / MDZ_ANSI_ALG_BITMAP_WORD_BITS)
+ */
+#define MDZ_ANSI_ALG_BITMAP_WORD_BITS (sizeof(unsigned long) * CHAR_BIT)
+
+/**
+ * Number of words of bitmap necessary for nBitsCount bits
+ */
+#define MDZ_ANSI_ALG_BITMAP_WORDS(nBitsCount) (((nBitsCount) + MDZ_ANSI_ALG_BITMAP_WORD_BITS - 1) / MDZ_ANSI_ALG_BITMAP_WORD_BITS)
+
+/**
+ * 0-based index of lowest set bit of bitmap word nBits, which cannot be 0. Portable version using de Bruijn multiplication. nBits is evaluated twice
+ */
+#if ULONG_MAX > 0xFFFFFFFFUL
+#define MDZ_ANSI_ALG_BITMAP_LOWEST_PORTABLE(nBits) ((size_t) "\000\001\060\002\071\061\034\003\075\072\062\052\046\035\021\004\076\067\073\044\065\063\053\026\055\047\041\036\030\022\014\005\077\057\070\033\074\051\045\020\066\043\064\025\054\040\027\013\056\032\050\017\042\024\037\012\031\016\023\011\015\010\007\006"[((unsigned long) ((nBits) & (0UL - (nBits))) * 0x03F79D71B4CB0A89UL) >> 58])
+#else
+#define MDZ_ANSI_ALG_BITMAP_LOWEST_PORTABLE(nBits) ((size_t) "\000\001\034\002\035\016\030\003\036\026\024\017\031\021\004\010\037\033\015\027\025\023\020\007\032\014\022\006\013\005\012\011"[((unsigned long) ((nBits) & (0UL - (nBits))) * 0x077CB531UL) >> 27])
+#endif
+
+/**
+ * 0-based index of lowest set bit of bitmap word nBits, which cannot be 0. Compiles into single instruction with GCC and Clang, otherwise MDZ_ANSI_ALG_BITMAP_LOWEST_PORTABLE() is used. Set bits of bitmap are iterated word-wise, without library calls:
+ *
+ *   for (i = 0; i < MDZ_ANSI_ALG_BITMAP_WORDS(nBitsCount); i++)
+ *   {
+ *     unsigned long nBits = pnBitmap[i];
+ *     while (0 != nBits)
+ *     {
+ *       size_t nPos = nLeftPos + i * MDZ_ANSI_ALG_BITMAP_WORD_BITS + MDZ_ANSI_ALG_BITMAP_LOWEST(nBits);
+ *       ...
+ *       nBits &= nBits - 1;
+ *     }
+ *   }
+ */
+#if defined(__GNUC__)
+#define MDZ_ANSI_ALG_BITMAP_LOWEST(nBits) ((size_t) __builtin_ctzl(nBits))
+#else
+#define MDZ_ANSI_ALG_BITMAP_LOWEST(nBits) MDZ_ANSI_ALG_BITMAP_LOWEST_PORTABLE(nBits)
+#endif
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -45,6 +112,8 @@ extern "C"
 
   /**
    * Initializes mdz_ansi_alg library and license. This function should be called before any other function of the library.
+   * This function is not thread-safe: it should be called once, before library functions are used from other threads
+   * Function does not allocate memory. Startup cost of library (loading, initialization, first search) is measured by tests/mdz_ansi_alg_startup_bench.c. Please note, that functions of 0.3 binaries called with big search area validate license again (please refer to "thread-safety" in description of library)
    * \param pnFirstNameHash - user first name hash code
    * \param pnLastNameHash  - user last name hash code
    * \param pnEmailHash     - user e-mail hash code
@@ -54,6 +123,24 @@ extern "C"
    */
   mdz_bool mdz_ansi_alg_init(const unsigned long* pnFirstNameHash, const unsigned long* pnLastNameHash, const unsigned long* pnEmailHash, const unsigned long* pnLicenseHash);
 
+#if MDZ_ANSI_ALG_VERSION >= 4
+  /**
+   * Returns level of SIMD instructions used by library functions. Level is selected in mdz_ansi_alg_init() as highest level supported by CPU and operating system, and may be lowered using mdz_ansi_alg_setSimd(). On targets without SIMD instructions level is MDZ_ANSI_SIMD_SWAR
+   * \return:
+   * Level of SIMD instructions (please refer to description of mdz_ansi_simd enum). Result is undefined if library is not initialized
+   */
+  enum mdz_ansi_simd mdz_ansi_alg_getSimd(void);
+
+  /**
+   * Limits level of SIMD instructions used by library functions, for example to compare performance of different levels. Level cannot be raised above highest level supported by CPU and operating system.
+   * This function is not thread-safe: level is process-global, thus function should be called after mdz_ansi_alg_init(), before library functions are used from other threads. Level cannot be selected per call or per thread
+   * \param enSimd - maximal level of SIMD instructions to use
+   * \return:
+   * Level of SIMD instructions used after this call
+   */
+  enum mdz_ansi_simd mdz_ansi_alg_setSimd(enum mdz_ansi_simd enSimd);
+#endif
+
   /**
    * \defgroup Insert/remove functions
    */
@@ -129,6 +216,33 @@ extern "C"
    */
   size_t mdz_ansi_alg_find(const char* pcData, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, enum mdz_error* penError);
 
+#if MDZ_ANSI_ALG_VERSION >= 4
+  /**
+   * Find first occurrence of pcItems in pcData using two rarest bytes of pcItems as search anchors. Returns 0-based position of match (if found), or SIZE_MAX if not found or error happened. If penError is not NULL, error will be written there
+   * Anchors are chosen according to pnFrequencies. Use this function instead of mdz_ansi_alg_find() if first/last bytes of pcItems are frequent in pcData (like spaces or 'e' in English text)
+   * \param pcData        - pointer to string
+   * \param nLeftPos      - 0-based start position to search from left. Use 0 to search from the beginning of string
+   * \param nRightPos     - 0-based end position to search up to. Use Size-1 to search till the end of string
+   * \param pcItems       - items to find. Cannot be NULL
+   * \param nCount        - number of items to find. Cannot be 0
+   * \param pnFrequencies - histogram of 256 items with frequency of every byte value in searched corpus. Use NULL for built-in English/ASCII text frequency table
+   * \param penError      - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos > nRightPos
+   * MDZ_ERROR_BIG_COUNT  - nCount is bigger than search area (between nLeftPos and nRightPos)
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * SIZE_MAX - if pcItems not found or error happened
+   * Result   - 0-based position of first match
+   */
+  size_t mdz_ansi_alg_findRare(const char* pcData, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, const size_t* pnFrequencies, enum mdz_error* penError);
+#endif
+
   /**
    * Find last occurrence of cItem in pcData. Returns 0-based position of match (if found), or SIZE_MAX if not found or error happened. If penError is not NULL, error will be written there
    * \param pcData    - pointer to string
@@ -372,6 +486,99 @@ extern "C"
    */
   enum mdz_error mdz_ansi_alg_trim(char* pcData, size_t* pnDataSize, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount);
 
+#if MDZ_ANSI_ALG_VERSION >= 4
+  /**
+   * Compute range which remains after trimming items contained in pcItems from left. pcData is not modified and does not need 0-terminator, thus it may be shared read-only memory used from many threads simultaneously
+   * \param pcData     - pointer to string
+   * \param nLeftPos   - 0-based start position to trim item(s) from left. Use 0 to trim from the beginning of string
+   * \param nRightPos  - 0-based end position to trim item(s) up to. Use Size-1 to trim till the end of string
+   * \param pcItems    - items to trim. Cannot be NULL
+   * \param nCount     - number of items to trim. Cannot be 0
+   * \param pnLeftPos  - 0-based start position of remaining range is returned here. Cannot be NULL
+   * \param pnRightPos - 0-based end position of remaining range (nRightPos) is returned here. Cannot be NULL
+   * \return:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos > nRightPos
+   * MDZ_ERROR_SIZE       - pnLeftPos or pnRightPos is NULL
+   * MDZ_ERROR_NONE       - function succeeded. If all items are trimmed, *pnLeftPos is nRightPos + 1 and *pnRightPos is nRightPos (empty range)
+   */
+  enum mdz_error mdz_ansi_alg_trimLeftRange(const char* pcData, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, size_t* pnLeftPos, size_t* pnRightPos);
+
+  /**
+   * Compute range which remains after trimming items contained in pcItems from right. pcData is not modified and does not need 0-terminator, thus it may be shared read-only memory used from many threads simultaneously
+   * \param pcData     - pointer to string
+   * \param nLeftPos   - 0-based end position to trim item(s) up to. Use 0 to trim till the beginning of string
+   * \param nRightPos  - 0-based start position to trim item(s) from right. Use Size-1 to trim from the end of string
+   * \param pcItems    - items to trim. Cannot be NULL
+   * \param nCount     - number of items to trim. Cannot be 0
+   * \param pnLeftPos  - 0-based start position of remaining range (nLeftPos) is returned here. Cannot be NULL
+   * \param pnRightPos - 0-based end position of remaining range is returned here. Cannot be NULL
+   * \return:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos > nRightPos
+   * MDZ_ERROR_SIZE       - pnLeftPos or pnRightPos is NULL
+   * MDZ_ERROR_NONE       - function succeeded. If all items are trimmed, *pnLeftPos is nRightPos + 1 and *pnRightPos is nRightPos (empty range)
+   */
+  enum mdz_error mdz_ansi_alg_trimRightRange(const char* pcData, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, size_t* pnLeftPos, size_t* pnRightPos);
+
+  /**
+   * Compute range which remains after trimming items contained in pcItems from left and from right. pcData is not modified and does not need 0-terminator, thus it may be shared read-only memory used from many threads simultaneously
+   * \param pcData     - pointer to string
+   * \param nLeftPos   - 0-based start position to trim item(s) from left. Use 0 to trim from the beginning of string
+   * \param nRightPos  - 0-based start position to trim item(s) from right. Use Size-1 to trim from the end of string
+   * \param pcItems    - items to trim. Cannot be NULL
+   * \param nCount     - number of items to trim. Cannot be 0
+   * \param pnLeftPos  - 0-based start position of remaining range is returned here. Cannot be NULL
+   * \param pnRightPos - 0-based end position of remaining range is returned here. Cannot be NULL
+   * \return:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos > nRightPos
+   * MDZ_ERROR_SIZE       - pnLeftPos or pnRightPos is NULL
+   * MDZ_ERROR_NONE       - function succeeded. If all items are trimmed, *pnLeftPos is nRightPos + 1 and *pnRightPos is nRightPos (empty range)
+   */
+  enum mdz_error mdz_ansi_alg_trimRange(const char* pcData, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, size_t* pnLeftPos, size_t* pnRightPos);
+
+  /**
+   * Compute ranges which remain after removal of all occurrences of pcItems between nLeftPos and nRightPos. pcData is not modified and does not need 0-terminator, thus it may be shared read-only memory used from many threads simultaneously. Returns total number of remaining non-empty ranges; if it is bigger than nRangesCapacity, only first nRangesCapacity ranges are written. If penError is not NULL, error will be written there
+   * \param pcData           - pointer to string
+   * \param nLeftPos         - 0-based start position to remove item(s) from. Use 0 to search from the beginning of string
+   * \param nRightPos        - 0-based end position to remove item(s) up to. Use Size-1 to search till the end of string
+   * \param pcItems          - items to remove. Cannot be NULL
+   * \param nCount           - number of item(s) to remove. Cannot be 0
+   * \param bFromLeft        - mdz_true if search for items to remove from left side, otherwise from right
+   * \param pnLeftPositions  - array for 0-based start positions of remaining ranges, in ascending order. Can be NULL if nRangesCapacity is 0
+   * \param pnRightPositions - array for 0-based end positions of remaining ranges. Can be NULL if nRangesCapacity is 0
+   * \param nRangesCapacity  - number of items in pnLeftPositions and pnRightPositions. Use 0 to count ranges only
+   * \param penError         - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos > nRightPos
+   * MDZ_ERROR_BIG_COUNT  - nCount is bigger than search area (between nLeftPos and nRightPos)
+   * MDZ_ERROR_BUFFER     - pnLeftPositions or pnRightPositions is NULL and nRangesCapacity is not 0
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - total number of remaining ranges. 0 if nothing remains
+   */
+  size_t mdz_ansi_alg_removeRanges(const char* pcData, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, mdz_bool bFromLeft, size_t* pnLeftPositions, size_t* pnRightPositions, size_t nRangesCapacity, enum mdz_error* penError);
+#endif
+
   /**
    * \defgroup Miscellaneous functions
    */
@@ -399,6 +606,125 @@ extern "C"
    */
   enum mdz_ansi_compare_result mdz_ansi_alg_compare(const char* pcData, size_t nDataSize, size_t nLeftPos, const char* pcItems, size_t nCount, mdz_bool bPartialCompare, enum mdz_error* penError);
 
+#if MDZ_ANSI_ALG_VERSION >= 4
+  /**
+   * Compare content of string with pcItems starting from the end of compared area. Result is the same as of mdz_ansi_alg_compare(), but mismatch is found faster if strings share long prefix (like URLs on the same host). If penError is not NULL, error will be written there
+   * \param pcData          - pointer to string
+   * \param nDataSize       - Size of pcData
+   * \param nLeftPos        - 0-based start position to compare from left. Use 0 to compare from the beginning of string
+   * \param pcItems         - items to compare. Cannot be NULL
+   * \param nCount          - number of items to compare. Cannot be 0
+   * \param bPartialCompare - if mdz_true compare only nCount items, otherwise compare full strings
+   * \param penError        - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_SIZE       - Size is 0 (empty string)
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos >= Size
+   * MDZ_ERROR_BIG_COUNT  - nLeftPos + nCount > Size
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * MDZ_ANSI_COMPARE_EQUAL or MDZ_ANSI_COMPARE_NONEQUAL - Result of comparison
+   */
+  enum mdz_ansi_compare_result mdz_ansi_alg_rcompare(const char* pcData, size_t nDataSize, size_t nLeftPos, const char* pcItems, size_t nCount, mdz_bool bPartialCompare, enum mdz_error* penError);
+
+  /**
+   * Compare content of string with pcItems in natural ("version-aware") order: runs of digits are compared numerically, like "file9" < "file10", other bytes are compared by value as unsigned char (like memcmp()), thus bytes 128..255 are greater than bytes 0..127 on every platform. Equal prefix of strings is skipped first. Digit runs of any length are compared exactly, without conversion to integer: run with more significant digits (after leading zeros) is greater, runs with the same number of significant digits are compared digit by digit. Numerically equal runs with different number of leading zeros (like "07" and "7") are ordered by rest of strings first; if the rest is equal too, string with fewer leading zeros in first such run is smaller ("7" < "07"). Thus MDZ_ANSI_COMPARE_EQUAL is returned only for byte-equal strings. If penError is not NULL, error will be written there
+   * \param pcData    - pointer to string
+   * \param nDataSize - Size of pcData. Can be 0
+   * \param pcItems   - items to compare. Cannot be NULL
+   * \param nCount    - number of items to compare. Can be 0
+   * \param penError  - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA    - pcData is NULL
+   * MDZ_ERROR_ITEMS   - pcItems is NULL
+   * MDZ_ERROR_NONE    - function succeeded
+   * \return:
+   * MDZ_ANSI_COMPARE_EQUAL   - strings are equal
+   * MDZ_ANSI_COMPARE_GREATER - pcData is greater than pcItems
+   * MDZ_ANSI_COMPARE_SMALLER - pcData is smaller than pcItems
+   * MDZ_ANSI_COMPARE_ERROR   - error happened
+   */
+  enum mdz_ansi_compare_result mdz_ansi_alg_compareNatural(const char* pcData, size_t nDataSize, const char* pcItems, size_t nCount, enum mdz_error* penError);
+
+  /**
+   * Compare content of string with pcItems using collation weights of pcWeights table (for example for ANSI code page). Bytes are compared by their weights, shorter string is smaller if it is a prefix of longer one. Equal prefix of strings is skipped first. If penError is not NULL, error will be written there
+   * \param pcData    - pointer to string
+   * \param nDataSize - Size of pcData. Can be 0
+   * \param pcItems   - items to compare. Cannot be NULL
+   * \param nCount    - number of items to compare. Can be 0
+   * \param pcWeights - table of 256 collation weights, indexed by byte value. Cannot be NULL
+   * \param penError  - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA    - pcData is NULL
+   * MDZ_ERROR_ITEMS   - pcItems is NULL
+   * MDZ_ERROR_TABLE   - pcWeights is NULL
+   * MDZ_ERROR_NONE    - function succeeded
+   * \return:
+   * MDZ_ANSI_COMPARE_EQUAL   - strings are equal
+   * MDZ_ANSI_COMPARE_GREATER - pcData is greater than pcItems
+   * MDZ_ANSI_COMPARE_SMALLER - pcData is smaller than pcItems
+   * MDZ_ANSI_COMPARE_ERROR   - error happened
+   */
+  enum mdz_ansi_compare_result mdz_ansi_alg_compareCollation(const char* pcData, size_t nDataSize, const char* pcItems, size_t nCount, const unsigned char* pcWeights, enum mdz_error* penError);
+
+  /**
+   * Returns length of longest common prefix of pcData and pcItems. Result is the same as of byte-by-byte comparison; future SIMD kernels may compare in 32/64-byte blocks, but current binaries contain no SIMD code. If penError is not NULL, error will be written there
+   * \param pcData    - pointer to string
+   * \param nDataSize - Size of pcData. Can be 0
+   * \param pcItems   - items to compare. Cannot be NULL
+   * \param nCount    - number of items to compare. Can be 0
+   * \param penError  - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA    - pcData is NULL
+   * MDZ_ERROR_ITEMS   - pcItems is NULL
+   * MDZ_ERROR_NONE    - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - length of common prefix. 0 if first items differ
+   */
+  size_t mdz_ansi_alg_commonPrefix(const char* pcData, size_t nDataSize, const char* pcItems, size_t nCount, enum mdz_error* penError);
+
+  /**
+   * Returns length of longest common suffix of pcData and pcItems. Comparison is made from the end; result is the same as of byte-by-byte comparison. Future SIMD kernels may compare in 32/64-byte blocks, but current binaries contain no SIMD code. If penError is not NULL, error will be written there
+   * \param pcData    - pointer to string
+   * \param nDataSize - Size of pcData. Can be 0
+   * \param pcItems   - items to compare. Cannot be NULL
+   * \param nCount    - number of items to compare. Can be 0
+   * \param penError  - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA    - pcData is NULL
+   * MDZ_ERROR_ITEMS   - pcItems is NULL
+   * MDZ_ERROR_NONE    - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - length of common suffix. 0 if last items differ
+   */
+  size_t mdz_ansi_alg_commonSuffix(const char* pcData, size_t nDataSize, const char* pcItems, size_t nCount, enum mdz_error* penError);
+
+  /**
+   * Calculates LCP array of sorted strings: pnPrefixes[0] is 0, pnPrefixes[i] is length of longest common prefix of strings i-1 and i
+   * \param ppcItems    - array of pointers to strings. Cannot be NULL, pointers cannot be NULL
+   * \param pnSizes     - array of Sizes of strings from ppcItems. Cannot be NULL
+   * \param nItemsCount - number of strings in ppcItems. Cannot be 0
+   * \param pnPrefixes  - array for nItemsCount results. Cannot be NULL
+   * \return:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_ITEMS      - ppcItems is NULL or one of its pointers is NULL
+   * MDZ_ERROR_SIZE       - pnSizes is NULL
+   * MDZ_ERROR_ZERO_COUNT - nItemsCount is 0
+   * MDZ_ERROR_BUFFER     - pnPrefixes is NULL
+   * MDZ_ERROR_NONE       - function succeeded, results are written in pnPrefixes
+   */
+  enum mdz_error mdz_ansi_alg_commonPrefixes(const char* const* ppcItems, const size_t* pnSizes, size_t nItemsCount, size_t* pnPrefixes);
+#endif
+
   /**
    * Counts number of pcItems substring occurences in string. If penError is not NULL, error will be written there
    * \param pcData           - pointer to string
@@ -472,6 +798,893 @@ extern "C"
    */
   enum mdz_error mdz_ansi_alg_reverse(char* pcData, size_t nLeftPos, size_t nRightPos);
 
+#if MDZ_ANSI_ALG_VERSION >= 4
+  /**
+   * Copy characters of pcData between nLeftPos and nRightPos into pcResult in reversed order, like "1234" into "4321". pcData is not modified and does not need 0-terminator, thus it may be shared read-only memory used from many threads simultaneously
+   * \param pcData    - pointer to string
+   * \param nLeftPos  - 0-based start position of range to reverse. Use 0 to reverse from the beginning of string
+   * \param nRightPos - 0-based end position of range to reverse. Use Size-1 to reverse till the end of string
+   * \param pcResult  - memory for nRightPos - nLeftPos + 1 reversed characters. 0-terminator is not written. Cannot be NULL and cannot overlap with pcData
+   * \return:
+   * MDZ_ERROR_LICENSE   - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA      - pcData is NULL
+   * MDZ_ERROR_BIG_RIGHT - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT  - nLeftPos > nRightPos
+   * MDZ_ERROR_BUFFER    - pcResult is NULL
+   * MDZ_ERROR_OVERLAP   - pcResult overlaps with pcData
+   * MDZ_ERROR_NONE      - function succeeded
+   */
+  enum mdz_error mdz_ansi_alg_reverseCopy(const char* pcData, size_t nLeftPos, size_t nRightPos, char* pcResult);
+
+  /**
+   * \defgroup Front-coding functions
+   */
+
+  /**
+   * Build front-coded (prefix-compressed) block of sorted strings in pBuffer. Every nRestartInterval-th string is stored in full (restart point), other strings are stored as length of prefix shared with previous string plus remaining suffix.
+   * Block is not modified by other front-coding functions, thus it may be used from many threads simultaneously
+   * \param ppcItems         - array of pointers to strings, sorted in ascending order without duplicates: first differing bytes are compared as unsigned char (like memcmp()), string which is a prefix of other string goes first. Cannot be NULL, pointers cannot be NULL
+   * \param pnSizes          - array of Sizes of strings from ppcItems. Cannot be NULL, Sizes cannot be 0
+   * \param nItemsCount      - number of strings in ppcItems. Cannot be 0
+   * \param nRestartInterval - number of strings between restart points. Cannot be 0
+   * \param pBuffer          - memory for block, aligned at least to sizeof(size_t). Can be NULL only if nBufferSize is 0: then only minimal-necessary size is returned in pnBufferSize
+   * \param nBufferSize      - size of pBuffer memory in bytes
+   * \param pnBufferSize     - if nBufferSize is not enough for block - minimal-necessary size is returned here, if pnBufferSize is not NULL. Otherwise used size of pBuffer is returned here
+   * \return:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_ITEMS        - ppcItems is NULL or one of its pointers is NULL
+   * MDZ_ERROR_SIZE         - pnSizes is NULL or one of Sizes is 0
+   * MDZ_ERROR_ZERO_COUNT   - nItemsCount is 0 or nRestartInterval is 0
+   * MDZ_ERROR_ORDER        - strings are not sorted in ascending order (of unsigned bytes, prefix first) or contain duplicates
+   * MDZ_ERROR_BUFFER       - pBuffer is NULL and nBufferSize is not 0, or pBuffer is not aligned to sizeof(size_t)
+   * MDZ_ERROR_SMALL_BUFFER - nBufferSize is not enough for block
+   * MDZ_ERROR_NONE         - function succeeded
+   */
+  enum mdz_error mdz_ansi_alg_frontCodeBuild(const char* const* ppcItems, const size_t* pnSizes, size_t nItemsCount, size_t nRestartInterval, void* pBuffer, size_t nBufferSize, size_t* pnBufferSize);
+
+  /**
+   * Find pcItems in front-coded block. Restart points are binary-searched using comparison of strings, then block between two restart points is scanned. Returns 0-based index of string (if found), or SIZE_MAX if not found or error happened. If penError is not NULL, error will be written there
+   * \param pBuffer  - block built with mdz_ansi_alg_frontCodeBuild(). Cannot be NULL
+   * \param pcItems  - items to find. Cannot be NULL
+   * \param nCount   - number of items to find. Cannot be 0
+   * \param penError - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_BUFFER     - pBuffer is NULL or does not contain front-coded block
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * SIZE_MAX - if pcItems not found or error happened
+   * Result   - 0-based index of string in ppcItems, used for block building
+   */
+  size_t mdz_ansi_alg_frontCodeFind(const void* pBuffer, const char* pcItems, size_t nCount, enum mdz_error* penError);
+
+  /**
+   * Decode string with nIndex index from front-coded block into pcData. New size is returned in pnDataSize, 0-terminator is written at [Size] position
+   * \param pBuffer       - block built with mdz_ansi_alg_frontCodeBuild(). Cannot be NULL
+   * \param nIndex        - 0-based index of string to decode
+   * \param pcData        - pointer to string for decoded string
+   * \param pnDataSize    - pointer to Size. If decoding succeeded, Size of decoded string is returned here
+   * \param nDataCapacity - maximal capacity of pcData buffer. nDataCapacity does not include 0-terminator byte, thus pcData buffer should be at least 1 byte bigger than nDataCapacity
+   * \return:
+   * MDZ_ERROR_LICENSE   - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_BUFFER    - pBuffer is NULL or does not contain front-coded block
+   * MDZ_ERROR_BIG_LEFT  - nIndex is not less than number of strings in block
+   * MDZ_ERROR_DATA      - pcData is NULL
+   * MDZ_ERROR_SIZE      - pnDataSize is NULL
+   * MDZ_ERROR_CAPACITY  - nDataCapacity is SIZE_MAX (no space for 0-terminator)
+   * MDZ_ERROR_BIG_COUNT - decoded Size > nDataCapacity
+   * MDZ_ERROR_NONE      - function succeeded, decoded size is written in pnDataSize
+   */
+  enum mdz_error mdz_ansi_alg_frontCodeGet(const void* pBuffer, size_t nIndex, char* pcData, size_t* pnDataSize, size_t nDataCapacity);
+
+  /**
+   * \defgroup Trie functions
+   */
+
+  /**
+   * Build static double-array trie of sorted strings in pBuffer. Trie is a flat array without pointers, it is not modified by other trie functions, thus it may be used from many threads simultaneously
+   * \param ppcItems     - array of pointers to strings, sorted in ascending order without duplicates: first differing bytes are compared as unsigned char (like memcmp()), string which is a prefix of other string goes first. Cannot be NULL, pointers cannot be NULL
+   * \param pnSizes      - array of Sizes of strings from ppcItems. Cannot be NULL, Sizes cannot be 0
+   * \param nItemsCount  - number of strings in ppcItems. Cannot be 0
+   * \param pBuffer      - memory for trie, aligned at least to sizeof(size_t). Can be NULL only if nBufferSize is 0: then only minimal-necessary size is returned in pnBufferSize
+   * \param nBufferSize  - size of pBuffer memory in bytes
+   * \param pnBufferSize - if nBufferSize is not enough for trie - minimal-necessary size is returned here, if pnBufferSize is not NULL. Otherwise used size of pBuffer is returned here
+   * \return:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_ITEMS        - ppcItems is NULL or one of its pointers is NULL
+   * MDZ_ERROR_SIZE         - pnSizes is NULL or one of Sizes is 0
+   * MDZ_ERROR_ZERO_COUNT   - nItemsCount is 0
+   * MDZ_ERROR_ORDER        - strings are not sorted in ascending order (of unsigned bytes, prefix first) or contain duplicates
+   * MDZ_ERROR_BUFFER       - pBuffer is NULL and nBufferSize is not 0, or pBuffer is not aligned to sizeof(size_t)
+   * MDZ_ERROR_SMALL_BUFFER - nBufferSize is not enough for trie
+   * MDZ_ERROR_NONE         - function succeeded
+   */
+  enum mdz_error mdz_ansi_alg_trieBuild(const char* const* ppcItems, const size_t* pnSizes, size_t nItemsCount, void* pBuffer, size_t nBufferSize, size_t* pnBufferSize);
+
+  /**
+   * Find exact match of pcItems in trie. Returns 0-based index of string (if found), or SIZE_MAX if not found or error happened. If penError is not NULL, error will be written there
+   * \param pBuffer  - trie built with mdz_ansi_alg_trieBuild(). Cannot be NULL
+   * \param pcItems  - items to find. Cannot be NULL
+   * \param nCount   - number of items to find. Cannot be 0
+   * \param penError - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_BUFFER     - pBuffer is NULL or does not contain trie
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * SIZE_MAX - if pcItems not found or error happened
+   * Result   - 0-based index of string in ppcItems, used for trie building
+   */
+  size_t mdz_ansi_alg_trieFind(const void* pBuffer, const char* pcItems, size_t nCount, enum mdz_error* penError);
+
+  /**
+   * Find longest string of trie which is a prefix of pcData, starting from nLeftPos position (for example longest route matching URL). Returns 0-based index of string (if found), or SIZE_MAX if not found or error happened. If penError is not NULL, error will be written there
+   * \param pBuffer   - trie built with mdz_ansi_alg_trieBuild(). Cannot be NULL
+   * \param pcData    - pointer to string
+   * \param nLeftPos  - 0-based start position of prefix
+   * \param nRightPos - 0-based end position to match up to. Use Size-1 to match till the end of string
+   * \param pnLength  - if not NULL, Size of matched string is written here
+   * \param penError  - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE   - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_BUFFER    - pBuffer is NULL or does not contain trie
+   * MDZ_ERROR_DATA      - pcData is NULL
+   * MDZ_ERROR_BIG_RIGHT - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT  - nLeftPos > nRightPos
+   * MDZ_ERROR_NONE      - function succeeded
+   * \return:
+   * SIZE_MAX - if no string of trie is a prefix of pcData or error happened
+   * Result   - 0-based index of longest matching string in ppcItems, used for trie building
+   */
+  size_t mdz_ansi_alg_trieLongestPrefix(const void* pBuffer, const char* pcData, size_t nLeftPos, size_t nRightPos, size_t* pnLength, enum mdz_error* penError);
+
+  /**
+   * Find all occurrences of all trie strings in pcData between nLeftPos and nRightPos, in one pass. Matches are written ordered by position, then by Size. Returns total number of matches; if it is bigger than nMatchesCapacity, only first nMatchesCapacity matches are written. If penError is not NULL, error will be written there
+   * \param pBuffer          - trie built with mdz_ansi_alg_trieBuild(). Cannot be NULL
+   * \param pcData           - pointer to string
+   * \param nLeftPos         - 0-based start position to search from left. Use 0 to search from the beginning of string
+   * \param nRightPos        - 0-based end position to search up to. Use Size-1 to search till the end of string
+   * \param pnPositions      - array for 0-based positions of matches. Can be NULL if nMatchesCapacity is 0
+   * \param pnIndexes        - array for 0-based indexes of matched strings in ppcItems, used for trie building. Can be NULL if nMatchesCapacity is 0
+   * \param nMatchesCapacity - number of items in pnPositions and pnIndexes. Use 0 to count matches only
+   * \param penError         - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE   - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_BUFFER    - pBuffer is NULL or does not contain trie, or pnPositions/pnIndexes is NULL and nMatchesCapacity is not 0
+   * MDZ_ERROR_DATA      - pcData is NULL
+   * MDZ_ERROR_BIG_RIGHT - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT  - nLeftPos > nRightPos
+   * MDZ_ERROR_NONE      - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - total number of matches. 0 if not found
+   */
+  size_t mdz_ansi_alg_trieScan(const void* pBuffer, const char* pcData, size_t nLeftPos, size_t nRightPos, size_t* pnPositions, size_t* pnIndexes, size_t nMatchesCapacity, enum mdz_error* penError);
+
+  /**
+   * \defgroup Perfect hash functions
+   */
+
+  /**
+   * Build minimal perfect hash of fixed keywords set (like HTTP methods, header names, SQL keywords) in pBuffer. Every keyword gets its own slot, thus lookup needs one hash calculation and one comparison. Hash is not modified by mdz_ansi_alg_perfectHashFind(), thus it may be used from many threads simultaneously
+   * \param ppcItems     - array of pointers to keywords, in any order without duplicates. Cannot be NULL, pointers cannot be NULL
+   * \param pnSizes      - array of Sizes of keywords from ppcItems. Cannot be NULL, Sizes cannot be 0
+   * \param nItemsCount  - number of keywords in ppcItems. Cannot be 0
+   * \param pBuffer      - memory for hash, aligned at least to sizeof(size_t). Can be NULL only if nBufferSize is 0: then only minimal-necessary size is returned in pnBufferSize
+   * \param nBufferSize  - size of pBuffer memory in bytes
+   * \param pnBufferSize - if nBufferSize is not enough for hash - minimal-necessary size is returned here, if pnBufferSize is not NULL. Otherwise used size of pBuffer is returned here
+   * \return:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_ITEMS        - ppcItems is NULL or one of its pointers is NULL
+   * MDZ_ERROR_SIZE         - pnSizes is NULL or one of Sizes is 0
+   * MDZ_ERROR_ZERO_COUNT   - nItemsCount is 0
+   * MDZ_ERROR_ORDER        - keywords contain duplicates
+   * MDZ_ERROR_BUFFER       - pBuffer is NULL and nBufferSize is not 0, or pBuffer is not aligned to sizeof(size_t)
+   * MDZ_ERROR_SMALL_BUFFER - nBufferSize is not enough for hash
+   * MDZ_ERROR_NONE         - function succeeded
+   */
+  enum mdz_error mdz_ansi_alg_perfectHashBuild(const char* const* ppcItems, const size_t* pnSizes, size_t nItemsCount, void* pBuffer, size_t nBufferSize, size_t* pnBufferSize);
+
+  /**
+   * Recognize keyword residing in pcData between nLeftPos and nRightPos (whole range should match keyword). Returns 0-based index of keyword (if found), or SIZE_MAX if not found or error happened. If penError is not NULL, error will be written there
+   * \param pBuffer   - hash built with mdz_ansi_alg_perfectHashBuild(). Cannot be NULL
+   * \param pcData    - pointer to string
+   * \param nLeftPos  - 0-based start position of token
+   * \param nRightPos - 0-based end position of token
+   * \param penError  - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE   - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_BUFFER    - pBuffer is NULL or does not contain perfect hash
+   * MDZ_ERROR_DATA      - pcData is NULL
+   * MDZ_ERROR_BIG_RIGHT - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT  - nLeftPos > nRightPos
+   * MDZ_ERROR_NONE      - function succeeded
+   * \return:
+   * SIZE_MAX - if token is not a keyword or error happened
+   * Result   - 0-based index of keyword in ppcItems, used for hash building
+   */
+  size_t mdz_ansi_alg_perfectHashFind(const void* pBuffer, const char* pcData, size_t nLeftPos, size_t nRightPos, enum mdz_error* penError);
+
+  /**
+   * \defgroup Filter functions
+   */
+
+  /**
+   * Build q-gram Bloom filter of patterns set in pBuffer. First q-gram (nQ bytes) of every pattern is added to filter, thus record which contains any pattern contains at least one q-gram of filter. Filter uses whole pBuffer for bits: the bigger nBufferSize, the less false positives. Filter is not modified by mdz_ansi_alg_qgramFilterCheck(), thus it may be used from many threads simultaneously
+   * \param ppcItems     - array of pointers to patterns. Cannot be NULL, pointers cannot be NULL
+   * \param pnSizes      - array of Sizes of patterns from ppcItems. Cannot be NULL
+   * \param nItemsCount  - number of patterns in ppcItems. Cannot be 0
+   * \param nQ           - length of q-gram. Cannot be 0 or bigger than Size of shortest pattern
+   * \param pBuffer      - memory for filter, aligned at least to sizeof(size_t). Can be NULL only if nBufferSize is 0: then only minimal-necessary size is returned in pnBufferSize
+   * \param nBufferSize  - size of pBuffer memory in bytes
+   * \param pnBufferSize - if nBufferSize is not enough for filter - minimal-necessary size is returned here, if pnBufferSize is not NULL
+   * \return:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_ITEMS        - ppcItems is NULL or one of its pointers is NULL
+   * MDZ_ERROR_SIZE         - pnSizes is NULL
+   * MDZ_ERROR_ZERO_COUNT   - nItemsCount is 0 or nQ is 0
+   * MDZ_ERROR_BIG_COUNT    - nQ is bigger than Size of shortest pattern
+   * MDZ_ERROR_BUFFER       - pBuffer is NULL and nBufferSize is not 0, or pBuffer is not aligned to sizeof(size_t)
+   * MDZ_ERROR_SMALL_BUFFER - nBufferSize is not enough for filter
+   * MDZ_ERROR_NONE         - function succeeded
+   */
+  enum mdz_error mdz_ansi_alg_qgramFilterBuild(const char* const* ppcItems, const size_t* pnSizes, size_t nItemsCount, size_t nQ, void* pBuffer, size_t nBufferSize, size_t* pnBufferSize);
+
+  /**
+   * Check q-grams of pcData between nLeftPos and nRightPos against filter, using rolling hash. If mdz_false is returned - record definitely does not contain any pattern of filter, otherwise record may contain pattern and should be checked using full matching. On error mdz_true is returned too, thus record is never skipped because of error. If penError is not NULL, error will be written there
+   * \param pBuffer   - filter built with mdz_ansi_alg_qgramFilterBuild(). Cannot be NULL
+   * \param pcData    - pointer to string
+   * \param nLeftPos  - 0-based start position to check from left. Use 0 to check from the beginning of string
+   * \param nRightPos - 0-based end position to check up to. Use Size-1 to check till the end of string
+   * \param penError  - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE   - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_BUFFER    - pBuffer is NULL or does not contain filter
+   * MDZ_ERROR_DATA      - pcData is NULL
+   * MDZ_ERROR_BIG_RIGHT - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT  - nLeftPos > nRightPos
+   * MDZ_ERROR_NONE      - function succeeded
+   * \return:
+   * mdz_false - pcData does not contain any pattern
+   * mdz_true  - pcData may contain pattern or error happened
+   */
+  mdz_bool mdz_ansi_alg_qgramFilterCheck(const void* pBuffer, const char* pcData, size_t nLeftPos, size_t nRightPos, enum mdz_error* penError);
+
+  /**
+   * \defgroup Chunking functions
+   */
+
+  /**
+   * Split pcData between nLeftPos and nRightPos into content-defined chunks using Gear rolling hash (FastCDC normalized chunking). Boundaries depend only on content, thus equal regions of different data versions give equal chunks. Returns total number of chunks; if it is bigger than nBoundariesCapacity, only first nBoundariesCapacity boundaries are written (chunking may be continued from last written boundary + 1). If penError is not NULL, error will be written there
+   * Last chunk always ends at nRightPos, also if it is not written because of nBoundariesCapacity. For stream processing, do not use last chunk if data continues: call function again with its start position as nLeftPos when more data is available
+   * \param pcData              - pointer to string
+   * \param nLeftPos            - 0-based start position of first chunk. Use 0 to chunk from the beginning of string
+   * \param nRightPos           - 0-based end position to chunk up to. Use Size-1 to chunk till the end of string
+   * \param nMinSize            - minimal size of chunk (except of last chunk). Cannot be 0
+   * \param nAvgSize            - desired average size of chunk. Should be power of 2, not smaller than nMinSize
+   * \param nMaxSize            - maximal size of chunk. Cannot be smaller than nAvgSize
+   * \param pnBoundaries        - array for 0-based end positions (inclusive) of chunks. Can be NULL if nBoundariesCapacity is 0
+   * \param nBoundariesCapacity - number of items in pnBoundaries. Use 0 to count chunks only
+   * \param penError            - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_BIG_RIGHT  - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos > nRightPos
+   * MDZ_ERROR_CHUNK      - nMinSize is 0, nAvgSize is not power of 2, nAvgSize < nMinSize or nMaxSize < nAvgSize
+   * MDZ_ERROR_BUFFER     - pnBoundaries is NULL and nBoundariesCapacity is not 0
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - total number of chunks
+   */
+  size_t mdz_ansi_alg_chunk(const char* pcData, size_t nLeftPos, size_t nRightPos, size_t nMinSize, size_t nAvgSize, size_t nMaxSize, size_t* pnBoundaries, size_t nBoundariesCapacity, enum mdz_error* penError);
+
+  /**
+   * \defgroup Diff functions
+   */
+
+  /**
+   * Calculate line-oriented difference between pcData and pcItems using linear-space Myers algorithm. Lines are separated by '\n'; lines are hashed first, thus only lines with equal hashes are compared. Edit script is written as entries of (type, position, length) into penTypes, pnPositions, pnLengths. Returns total number of entries; if it is bigger than nScriptCapacity, only first nScriptCapacity entries are written. If penError is not NULL, error will be written there
+   * \param pcData          - pointer to first (old) string
+   * \param nDataSize       - Size of pcData. Can be 0
+   * \param pcItems         - pointer to second (new) string. Cannot be NULL
+   * \param nCount          - Size of pcItems. Can be 0
+   * \param penTypes        - array for types of entries. Can be NULL if nScriptCapacity is 0
+   * \param pnPositions     - array for 0-based index of first line of entry: in pcData for MDZ_ANSI_DIFF_EQUAL and MDZ_ANSI_DIFF_DELETE, in pcItems for MDZ_ANSI_DIFF_INSERT. Can be NULL if nScriptCapacity is 0
+   * \param pnLengths       - array for number of lines of entries. Can be NULL if nScriptCapacity is 0
+   * \param nScriptCapacity - number of items in penTypes, pnPositions and pnLengths. Use 0 to count entries only
+   * \param pBuffer         - working memory, proportional to number of lines in pcData and pcItems, aligned at least to sizeof(size_t). Can be NULL only if nBufferSize is 0: then only minimal-necessary size is returned in pnBufferSize
+   * \param nBufferSize     - size of pBuffer memory in bytes
+   * \param pnBufferSize    - if nBufferSize is not enough - minimal-necessary size is returned here, if pnBufferSize is not NULL
+   * \param penError        - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA         - pcData is NULL
+   * MDZ_ERROR_ITEMS        - pcItems is NULL
+   * MDZ_ERROR_BUFFER       - pBuffer is NULL and nBufferSize is not 0, pBuffer is not aligned to sizeof(size_t), or penTypes/pnPositions/pnLengths is NULL and nScriptCapacity is not 0
+   * MDZ_ERROR_SMALL_BUFFER - nBufferSize is not enough for working memory
+   * MDZ_ERROR_NONE         - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - total number of edit script entries. 0 if both strings are empty
+   */
+  size_t mdz_ansi_alg_diffLines(const char* pcData, size_t nDataSize, const char* pcItems, size_t nCount, enum mdz_ansi_diff_type* penTypes, size_t* pnPositions, size_t* pnLengths, size_t nScriptCapacity, void* pBuffer, size_t nBufferSize, size_t* pnBufferSize, enum mdz_error* penError);
+
+  /**
+   * \defgroup Offsets encoding functions
+   */
+
+  /**
+   * Encode ascending array of offsets (like positions of matches or line starts) as deltas into pcBuffer. Encoded offsets start with number of offsets, thus decoder knows where encoding ends. Returns number of bytes written in pcBuffer. If penError is not NULL, error will be written there
+   * \param pnOffsets     - array of offsets in ascending order without duplicates. Can be NULL if nOffsetsCount is 0
+   * \param nOffsetsCount - number of offsets in pnOffsets. Can be 0
+   * \param enEncoding    - encoding of offsets (please refer to description of mdz_ansi_offsets_encoding enum)
+   * \param pcBuffer      - memory for encoded offsets. Can be NULL only if nBufferSize is 0: then only minimal-necessary size is returned in pnBufferSize
+   * \param nBufferSize   - size of pcBuffer memory in bytes
+   * \param pnBufferSize  - if nBufferSize is not enough - minimal-necessary size is returned here, if pnBufferSize is not NULL
+   * \param penError      - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_ITEMS        - pnOffsets is NULL and nOffsetsCount is not 0
+   * MDZ_ERROR_ORDER        - offsets are not in ascending order or contain duplicates
+   * MDZ_ERROR_BUFFER       - pcBuffer is NULL and nBufferSize is not 0, or enEncoding is invalid
+   * MDZ_ERROR_SMALL_BUFFER - nBufferSize is not enough for encoded offsets
+   * MDZ_ERROR_NONE         - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - number of bytes written in pcBuffer
+   */
+  size_t mdz_ansi_alg_encodeOffsets(const size_t* pnOffsets, size_t nOffsetsCount, enum mdz_ansi_offsets_encoding enEncoding, unsigned char* pcBuffer, size_t nBufferSize, size_t* pnBufferSize, enum mdz_error* penError);
+
+  /**
+   * Decode offsets encoded with mdz_ansi_alg_encodeOffsets() or mdz_ansi_alg_findAllEncoded() in bulk. Returns number of decoded offsets; if it is bigger than nOffsetsCapacity, only first nOffsetsCapacity offsets are written. If penError is not NULL, error will be written there
+   * \param pcBuffer         - encoded offsets. Can be NULL if nBufferSize is 0
+   * \param nBufferSize      - number of bytes in pcBuffer. Can be 0 (no offsets)
+   * \param enEncoding       - encoding used for pcBuffer
+   * \param pnOffsets        - array for decoded offsets. Can be NULL if nOffsetsCapacity is 0
+   * \param nOffsetsCapacity - number of items in pnOffsets. Use 0 to count offsets only
+   * \param penError         - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE   - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA      - pcBuffer is NULL and nBufferSize is not 0, or pcBuffer contains invalid encoding (like number of offsets, which does not fit nBufferSize)
+   * MDZ_ERROR_BUFFER    - enEncoding is invalid, or pnOffsets is NULL and nOffsetsCapacity is not 0
+   * MDZ_ERROR_NONE      - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - number of encoded offsets. 0 if nBufferSize is 0
+   */
+  size_t mdz_ansi_alg_decodeOffsets(const unsigned char* pcBuffer, size_t nBufferSize, enum mdz_ansi_offsets_encoding enEncoding, size_t* pnOffsets, size_t nOffsetsCapacity, enum mdz_error* penError);
+
+  /**
+   * Find all occurrences of pcItems in pcData and write their 0-based positions directly encoded into pcBuffer, without intermediate positions array. Positions are encoded like in mdz_ansi_alg_encodeOffsets(), starting with their number. If pcItems is longer than search area, nothing is found and only number 0 is encoded. Returns number of found occurrences. If penError is not NULL, error will be written there
+   * \param pcData           - pointer to string
+   * \param nLeftPos         - 0-based start position to search from left. Use 0 to search from the beginning of string
+   * \param nRightPos        - 0-based end position to search up to. Use Size-1 to search till the end of string
+   * \param pcItems          - items to find. Cannot be NULL
+   * \param nCount           - number of items to find. Cannot be 0
+   * \param bAllowOverlapped - mdz_true if overlapped substrings should be found, otherwise mdz_false
+   * \param enEncoding       - encoding of positions (please refer to description of mdz_ansi_offsets_encoding enum)
+   * \param pcBuffer         - memory for encoded positions. Can be NULL only if nBufferSize is 0: then only minimal-necessary size is returned in pnBufferSize
+   * \param nBufferSize      - size of pcBuffer memory in bytes
+   * \param pnBufferSize     - number of bytes written in pcBuffer is returned here. If nBufferSize is not enough - minimal-necessary size is returned here. Cannot be NULL
+   * \param penError         - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA         - pcData is NULL
+   * MDZ_ERROR_ITEMS        - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT   - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT    - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT     - nLeftPos > nRightPos
+   * MDZ_ERROR_BUFFER       - pcBuffer is NULL and nBufferSize is not 0, or enEncoding is invalid
+   * MDZ_ERROR_SIZE         - pnBufferSize is NULL
+   * MDZ_ERROR_SMALL_BUFFER - nBufferSize is not enough for all encoded positions. Content of pcBuffer is undefined
+   * MDZ_ERROR_NONE         - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - number of positions encoded in pcBuffer. 0 if not found
+   */
+  size_t mdz_ansi_alg_findAllEncoded(const char* pcData, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, mdz_bool bAllowOverlapped, enum mdz_ansi_offsets_encoding enEncoding, unsigned char* pcBuffer, size_t nBufferSize, size_t* pnBufferSize, enum mdz_error* penError);
+
+  /**
+   * \defgroup Bitmap functions
+   */
+
+  /**
+   * Mark all occurrences of cItem in pcData between nLeftPos and nRightPos in packed bitmap of words: bit i (please refer to MDZ_ANSI_ALG_BITMAP_WORD_BITS) is set if pcData[nLeftPos + i] is cItem, unused bits of last word are 0. Set bits are iterated using MDZ_ANSI_ALG_BITMAP_LOWEST() without further library calls. Returns number of set bits. If penError is not NULL, error will be written there
+   * \param pcData      - pointer to string
+   * \param nLeftPos    - 0-based start position to search from left. Use 0 to search from the beginning of string
+   * \param nRightPos   - 0-based end position to search up to. Use Size-1 to search till the end of string
+   * \param cItem       - character to find
+   * \param pnBitmap    - memory for bitmap. Cannot be NULL
+   * \param nBitmapSize - number of words in pnBitmap. Cannot be smaller than MDZ_ANSI_ALG_BITMAP_WORDS(nRightPos - nLeftPos + 1)
+   * \param penError    - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA         - pcData is NULL
+   * MDZ_ERROR_BIG_RIGHT    - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT     - nLeftPos > nRightPos
+   * MDZ_ERROR_BUFFER       - pnBitmap is NULL
+   * MDZ_ERROR_SMALL_BUFFER - nBitmapSize is not enough for bitmap
+   * MDZ_ERROR_NONE         - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - number of matches. 0 if not found
+   */
+  size_t mdz_ansi_alg_findSingleBitmap(const char* pcData, size_t nLeftPos, size_t nRightPos, char cItem, unsigned long* pnBitmap, size_t nBitmapSize, enum mdz_error* penError);
+
+  /**
+   * Mark all occurrences of any item of pcItems in pcData between nLeftPos and nRightPos in packed bitmap of words: bit i (please refer to MDZ_ANSI_ALG_BITMAP_WORD_BITS) is set if pcData[nLeftPos + i] is contained in pcItems, unused bits of last word are 0. Set bits are iterated using MDZ_ANSI_ALG_BITMAP_LOWEST() without further library calls. Returns number of set bits. If penError is not NULL, error will be written there
+   * \param pcData      - pointer to string
+   * \param nLeftPos    - 0-based start position to search from left. Use 0 to search from the beginning of string
+   * \param nRightPos   - 0-based end position to search up to. Use Size-1 to search till the end of string
+   * \param pcItems     - items to find. Cannot be NULL
+   * \param nCount      - number of items to find. Cannot be 0
+   * \param pnBitmap    - memory for bitmap. Cannot be NULL
+   * \param nBitmapSize - number of words in pnBitmap. Cannot be smaller than MDZ_ANSI_ALG_BITMAP_WORDS(nRightPos - nLeftPos + 1)
+   * \param penError    - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA         - pcData is NULL
+   * MDZ_ERROR_ITEMS        - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT   - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT    - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT     - nLeftPos > nRightPos
+   * MDZ_ERROR_BUFFER       - pnBitmap is NULL
+   * MDZ_ERROR_SMALL_BUFFER - nBitmapSize is not enough for bitmap
+   * MDZ_ERROR_NONE         - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - number of matches. 0 if not found
+   */
+  size_t mdz_ansi_alg_firstOfBitmap(const char* pcData, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, unsigned long* pnBitmap, size_t nBitmapSize, enum mdz_error* penError);
+
+  /**
+   * \defgroup Windows functions
+   */
+
+  /**
+   * Find first occurrence of pcItems in every window [pnLeftPositions[i], pnRightPositions[i]] of pcData. pcData and pcItems are checked and pcItems is prepared for search only once, windows are processed in given order (pass them sorted by start position for sequential memory access). All windows are checked before processing: if error is returned, results array is not modified
+   * \param pcData           - pointer to string
+   * \param pnLeftPositions  - array of 0-based start positions of windows. Cannot be NULL
+   * \param pnRightPositions - array of 0-based end positions of windows. Cannot be NULL
+   * \param nWindowsCount    - number of windows. Cannot be 0
+   * \param pcItems          - items to find. Cannot be NULL
+   * \param nCount           - number of items to find. Cannot be 0
+   * \param pnResults        - array for nWindowsCount results: 0-based position of first match in window, or SIZE_MAX if not found (also if window is smaller than nCount). Cannot be NULL
+   * \return:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_SIZE       - pnLeftPositions or pnRightPositions is NULL
+   * MDZ_ERROR_ZERO_SIZE  - nWindowsCount is 0
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - one of end positions is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - one of start positions is bigger than its end position
+   * MDZ_ERROR_BUFFER     - pnResults is NULL
+   * MDZ_ERROR_NONE       - function succeeded, results are written in pnResults
+   */
+  enum mdz_error mdz_ansi_alg_findWindows(const char* pcData, const size_t* pnLeftPositions, const size_t* pnRightPositions, size_t nWindowsCount, const char* pcItems, size_t nCount, size_t* pnResults);
+
+  /**
+   * Count occurrences of pcItems in every window [pnLeftPositions[i], pnRightPositions[i]] of pcData. pcData and pcItems are checked and pcItems is prepared for search only once, windows are processed in given order (pass them sorted by start position for sequential memory access). All windows are checked before processing: if error is returned, results array is not modified
+   * \param pcData           - pointer to string
+   * \param pnLeftPositions  - array of 0-based start positions of windows. Cannot be NULL
+   * \param pnRightPositions - array of 0-based end positions of windows. Cannot be NULL
+   * \param nWindowsCount    - number of windows. Cannot be 0
+   * \param pcItems          - items to find. Cannot be NULL
+   * \param nCount           - number of items to find. Cannot be 0
+   * \param bAllowOverlapped - mdz_true if overlapped substrings should be counted, otherwise mdz_false
+   * \param pnResults        - array for nWindowsCount results: count of occurrences in window. 0 if not found (also if window is smaller than nCount). Cannot be NULL
+   * \return:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_SIZE       - pnLeftPositions or pnRightPositions is NULL
+   * MDZ_ERROR_ZERO_SIZE  - nWindowsCount is 0
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - one of end positions is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - one of start positions is bigger than its end position
+   * MDZ_ERROR_BUFFER     - pnResults is NULL
+   * MDZ_ERROR_NONE       - function succeeded, results are written in pnResults
+   */
+  enum mdz_error mdz_ansi_alg_countWindows(const char* pcData, const size_t* pnLeftPositions, const size_t* pnRightPositions, size_t nWindowsCount, const char* pcItems, size_t nCount, mdz_bool bAllowOverlapped, size_t* pnResults);
+
+  /**
+   * Find first occurrence of any item of pcItems in every window [pnLeftPositions[i], pnRightPositions[i]] of pcData. pcData and pcItems are checked and set of items is prepared only once, windows are processed in given order (pass them sorted by start position for sequential memory access). All windows are checked before processing: if error is returned, results array is not modified
+   * \param pcData           - pointer to string
+   * \param pnLeftPositions  - array of 0-based start positions of windows. Cannot be NULL
+   * \param pnRightPositions - array of 0-based end positions of windows. Cannot be NULL
+   * \param nWindowsCount    - number of windows. Cannot be 0
+   * \param pcItems          - items to find. Cannot be NULL
+   * \param nCount           - number of items to find. Cannot be 0
+   * \param pnResults        - array for nWindowsCount results: 0-based position of first match in window, or SIZE_MAX if not found. Cannot be NULL
+   * \return:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_SIZE       - pnLeftPositions or pnRightPositions is NULL
+   * MDZ_ERROR_ZERO_SIZE  - nWindowsCount is 0
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - one of end positions is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - one of start positions is bigger than its end position
+   * MDZ_ERROR_BUFFER     - pnResults is NULL
+   * MDZ_ERROR_NONE       - function succeeded, results are written in pnResults
+   */
+  enum mdz_error mdz_ansi_alg_firstOfWindows(const char* pcData, const size_t* pnLeftPositions, const size_t* pnRightPositions, size_t nWindowsCount, const char* pcItems, size_t nCount, size_t* pnResults);
+
+  /**
+   * Compare content of every window [pnLeftPositions[i], pnRightPositions[i]] of pcData with pcItems. pcData and pcItems are checked only once, windows are processed in given order (pass them sorted by start position for sequential memory access). All windows are checked before processing: if error is returned, results array is not modified
+   * \param pcData           - pointer to string
+   * \param pnLeftPositions  - array of 0-based start positions of windows. Cannot be NULL
+   * \param pnRightPositions - array of 0-based end positions of windows. Cannot be NULL
+   * \param nWindowsCount    - number of windows. Cannot be 0
+   * \param pcItems          - items to compare. Cannot be NULL
+   * \param nCount           - number of items to compare. Cannot be 0
+   * \param bPartialCompare  - if mdz_true compare only nCount items from start of window, otherwise compare full window
+   * \param penResults       - array for nWindowsCount results: MDZ_ANSI_COMPARE_EQUAL or MDZ_ANSI_COMPARE_NONEQUAL (also if window is smaller than nCount). Cannot be NULL
+   * \return:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_SIZE       - pnLeftPositions or pnRightPositions is NULL
+   * MDZ_ERROR_ZERO_SIZE  - nWindowsCount is 0
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - one of end positions is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - one of start positions is bigger than its end position
+   * MDZ_ERROR_BUFFER     - penResults is NULL
+   * MDZ_ERROR_NONE       - function succeeded, results are written in penResults
+   */
+  enum mdz_error mdz_ansi_alg_compareWindows(const char* pcData, const size_t* pnLeftPositions, const size_t* pnRightPositions, size_t nWindowsCount, const char* pcItems, size_t nCount, mdz_bool bPartialCompare, enum mdz_ansi_compare_result* penResults);
+
+  /**
+   * \defgroup Stream functions
+   */
+
+  /**
+   * Initialize context in pContext for replacement of every occurence of pcItemsBefore with pcItemsAfter in stream of chunks. pcItemsBefore and pcItemsAfter are copied into context. Context holds at most nCountBefore - 1 not yet processed bytes between chunks, thus stream of any size is processed in constant memory
+   * \param pContext      - memory for context, aligned at least to sizeof(size_t). Can be NULL only if nContextSize is 0: then only minimal-necessary size is returned in pnContextSize
+   * \param nContextSize  - size of pContext memory in bytes
+   * \param pcItemsBefore - items to find. Cannot be NULL
+   * \param nCountBefore  - number of items to find. Cannot be 0
+   * \param pcItemsAfter  - pointer to items to replace with. Can be NULL
+   * \param nCountAfter   - number of items to replace. Can be 0
+   * \param pnContextSize - if nContextSize is not enough for context - minimal-necessary size is returned here, if pnContextSize is not NULL
+   * \return:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_CONTEXT      - pContext is NULL and nContextSize is not 0, or pContext is not aligned to sizeof(size_t)
+   * MDZ_ERROR_SMALL_BUFFER - nContextSize is not enough for context
+   * MDZ_ERROR_ITEMS        - pcItemsBefore is NULL, or pcItemsAfter is NULL and nCountAfter is not 0
+   * MDZ_ERROR_ZERO_COUNT   - nCountBefore is 0
+   * MDZ_ERROR_NONE         - function succeeded
+   */
+  enum mdz_error mdz_ansi_alg_replaceStreamInit(void* pContext, size_t nContextSize, const char* pcItemsBefore, size_t nCountBefore, const char* pcItemsAfter, size_t nCountAfter, size_t* pnContextSize);
+
+  /**
+   * Push next chunk of stream into replacement context and get replaced output. Occurrences spanning chunk boundaries are replaced correctly: bytes which may be start of occurrence are kept in context until next chunk. Output is not 0-terminated
+   * \param pContext        - context initialized with mdz_ansi_alg_replaceStreamInit(). Cannot be NULL
+   * \param pcData          - chunk of stream. Can be NULL if nDataSize is 0
+   * \param nDataSize       - Size of chunk. Can be 0
+   * \param pcOutput        - memory for output. Cannot be NULL and cannot overlap with pcData
+   * \param nOutputCapacity - size of pcOutput memory in bytes. nDataSize + nCountBefore - 1 is always enough if nCountAfter <= nCountBefore
+   * \param pnOutputSize    - number of bytes written in pcOutput is returned here. If nOutputCapacity is not enough - minimal-necessary capacity is returned here. Cannot be NULL
+   * \return:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_CONTEXT      - pContext is NULL or not initialized
+   * MDZ_ERROR_DATA         - pcData is NULL and nDataSize is not 0
+   * MDZ_ERROR_BUFFER       - pcOutput is NULL
+   * MDZ_ERROR_SIZE         - pnOutputSize is NULL
+   * MDZ_ERROR_OVERLAP      - pcOutput overlaps with pcData
+   * MDZ_ERROR_SMALL_BUFFER - nOutputCapacity is not enough for output. Chunk is not consumed, context is not changed
+   * MDZ_ERROR_NONE         - function succeeded, size of output is written in pnOutputSize
+   */
+  enum mdz_error mdz_ansi_alg_replaceStreamPush(void* pContext, const char* pcData, size_t nDataSize, char* pcOutput, size_t nOutputCapacity, size_t* pnOutputSize);
+
+  /**
+   * Finish stream: write bytes kept in replacement context (at most nCountBefore - 1) into pcOutput. After this call context should be initialized again for next stream
+   * \param pContext        - context initialized with mdz_ansi_alg_replaceStreamInit(). Cannot be NULL
+   * \param pcOutput        - memory for output. Cannot be NULL
+   * \param nOutputCapacity - size of pcOutput memory in bytes. nCountBefore - 1 is always enough
+   * \param pnOutputSize    - number of bytes written in pcOutput is returned here. If nOutputCapacity is not enough - minimal-necessary capacity is returned here. Cannot be NULL
+   * \return:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_CONTEXT      - pContext is NULL or not initialized
+   * MDZ_ERROR_BUFFER       - pcOutput is NULL
+   * MDZ_ERROR_SIZE         - pnOutputSize is NULL
+   * MDZ_ERROR_SMALL_BUFFER - nOutputCapacity is not enough for output
+   * MDZ_ERROR_NONE         - function succeeded, size of output is written in pnOutputSize
+   */
+  enum mdz_error mdz_ansi_alg_replaceStreamFinish(void* pContext, char* pcOutput, size_t nOutputCapacity, size_t* pnOutputSize);
+
+  /**
+   * Initialize context in pContext for statistics of stream of chunks: count of pcItems substring occurrences, histogram of bytes, count of lines and maximal line length. pcItems is copied into context. Context holds at most nCount - 1 bytes between chunks, thus stream of any size is processed in constant memory
+   * \param pContext         - memory for context, aligned at least to sizeof(size_t). Can be NULL only if nContextSize is 0: then only minimal-necessary size is returned in pnContextSize
+   * \param nContextSize     - size of pContext memory in bytes
+   * \param pcItems          - items to count. Can be NULL if nCount is 0
+   * \param nCount           - number of items to count. Use 0 if substring should not be counted
+   * \param bAllowOverlapped - mdz_true if overlapped substrings should be counted, otherwise mdz_false (like in mdz_ansi_alg_count() from left side)
+   * \param pnContextSize    - if nContextSize is not enough for context - minimal-necessary size is returned here, if pnContextSize is not NULL
+   * \return:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_CONTEXT      - pContext is NULL and nContextSize is not 0, or pContext is not aligned to sizeof(size_t)
+   * MDZ_ERROR_SMALL_BUFFER - nContextSize is not enough for context
+   * MDZ_ERROR_ITEMS        - pcItems is NULL and nCount is not 0
+   * MDZ_ERROR_NONE         - function succeeded
+   */
+  enum mdz_error mdz_ansi_alg_statsStreamInit(void* pContext, size_t nContextSize, const char* pcItems, size_t nCount, mdz_bool bAllowOverlapped, size_t* pnContextSize);
+
+  /**
+   * Push next chunk of stream into statistics context. Occurrences of substring and lines spanning chunk boundaries are counted correctly
+   * \param pContext  - context initialized with mdz_ansi_alg_statsStreamInit(). Cannot be NULL
+   * \param pcData    - chunk of stream. Can be NULL if nDataSize is 0
+   * \param nDataSize - Size of chunk. Can be 0
+   * \return:
+   * MDZ_ERROR_LICENSE - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_CONTEXT - pContext is NULL or not initialized
+   * MDZ_ERROR_DATA    - pcData is NULL and nDataSize is not 0
+   * MDZ_ERROR_NONE    - function succeeded
+   */
+  enum mdz_error mdz_ansi_alg_statsStreamPush(void* pContext, const char* pcData, size_t nDataSize);
+
+  /**
+   * Finish stream and get exact statistics of all pushed chunks. After this call context should be initialized again for next stream
+   * \param pContext        - context initialized with mdz_ansi_alg_statsStreamInit(). Cannot be NULL
+   * \param pnCount         - if not NULL, count of pcItems substring occurrences is written here
+   * \param pnHistogram     - if not NULL, 256 counts of every byte value are written here
+   * \param pnLines         - if not NULL, count of lines is written here: count of '\n' plus 1 if stream does not end with '\n'. 0 for empty stream
+   * \param pnMaxLineLength - if not NULL, maximal length of line without '\n' is written here
+   * \return:
+   * MDZ_ERROR_LICENSE - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_CONTEXT - pContext is NULL or not initialized
+   * MDZ_ERROR_NONE    - function succeeded
+   */
+  enum mdz_error mdz_ansi_alg_statsStreamFinish(void* pContext, size_t* pnCount, size_t* pnHistogram, size_t* pnLines, size_t* pnMaxLineLength);
+
+  /**
+   * Initialize context in pContext for search of all occurrences of pcItems in stream of chunks (like buffers of file read). pcItems is copied into context. Context holds at most nCount - 1 bytes between chunks and does not reference pushed chunks after mdz_ansi_alg_findStreamPush() returns, thus chunk buffer may be reused for next read immediately
+   * \param pContext         - memory for context, aligned at least to sizeof(size_t). Can be NULL only if nContextSize is 0: then only minimal-necessary size is returned in pnContextSize
+   * \param nContextSize     - size of pContext memory in bytes
+   * \param pcItems          - items to find. Cannot be NULL
+   * \param nCount           - number of items to find. Cannot be 0
+   * \param bAllowOverlapped - mdz_true if overlapped substrings should be found, otherwise mdz_false
+   * \param pnContextSize    - if nContextSize is not enough for context - minimal-necessary size is returned here, if pnContextSize is not NULL
+   * \return:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_CONTEXT      - pContext is NULL and nContextSize is not 0, or pContext is not aligned to sizeof(size_t)
+   * MDZ_ERROR_SMALL_BUFFER - nContextSize is not enough for context
+   * MDZ_ERROR_ITEMS        - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT   - nCount is 0
+   * MDZ_ERROR_NONE         - function succeeded
+   */
+  enum mdz_error mdz_ansi_alg_findStreamInit(void* pContext, size_t nContextSize, const char* pcItems, size_t nCount, mdz_bool bAllowOverlapped, size_t* pnContextSize);
+
+  /**
+   * Push next chunk of stream into search context and get 0-based stream positions of occurrences which end in this chunk. Occurrences spanning chunk boundaries are found correctly. Chunks should be pushed in stream order; reading of next chunks may be in progress meanwhile (double buffering)
+   * \param pContext           - context initialized with mdz_ansi_alg_findStreamInit(). Cannot be NULL
+   * \param pcData             - chunk of stream. Can be NULL if nDataSize is 0
+   * \param nDataSize          - Size of chunk. Can be 0
+   * \param pnPositions        - array for 0-based stream positions of occurrences. Can be NULL if nPositionsCapacity is 0
+   * \param nPositionsCapacity - number of items in pnPositions. Use 0 to count occurrences only
+   * \param pnPositionsCount   - number of occurrences ending in this chunk is returned here. Cannot be NULL
+   * \return:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_CONTEXT      - pContext is NULL or not initialized
+   * MDZ_ERROR_DATA         - pcData is NULL and nDataSize is not 0
+   * MDZ_ERROR_SIZE         - pnPositionsCount is NULL
+   * MDZ_ERROR_BUFFER       - pnPositions is NULL and nPositionsCapacity is not 0
+   * MDZ_ERROR_SMALL_BUFFER - nPositionsCapacity is not 0 and not enough for all occurrences. Chunk is not consumed, context is not changed, necessary capacity is returned in pnPositionsCount
+   * MDZ_ERROR_NONE         - function succeeded
+   */
+  enum mdz_error mdz_ansi_alg_findStreamPush(void* pContext, const char* pcData, size_t nDataSize, size_t* pnPositions, size_t nPositionsCapacity, size_t* pnPositionsCount);
+
+  /**
+   * \defgroup Segments functions
+   */
+
+  /**
+   * Find first occurrence of cItem in list of segments (like iovec array of network receive), treated as one logical string. Segments are not copied. Returns 0-based global position of match (if found), or SIZE_MAX if not found or error happened. If penError is not NULL, error will be written there
+   * \param ppcSegments    - array of pointers to segments. Cannot be NULL, pointer can be NULL only if Size of its segment is 0
+   * \param pnSegmentSizes - array of Sizes of segments. Cannot be NULL. Size of segment can be 0
+   * \param nSegmentsCount - number of segments. Cannot be 0
+   * \param nLeftPos       - 0-based global start position to search from left. Use 0 to search from the beginning of logical string
+   * \param nRightPos      - 0-based global end position to search up to. Use total Size-1 to search till the end of logical string
+   * \param cItem          - character to find
+   * \param pnSegment      - if not NULL, 0-based index of segment containing match is written here
+   * \param pnOffset       - if not NULL, 0-based offset of match inside of its segment is written here
+   * \param penError       - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - ppcSegments is NULL, or pointer of segment with non-zero Size is NULL
+   * MDZ_ERROR_SIZE       - pnSegmentSizes is NULL
+   * MDZ_ERROR_ZERO_SIZE  - nSegmentsCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - nRightPos is not less than total Size of segments
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos > nRightPos
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * SIZE_MAX - if cItem not found or error happened
+   * Result   - 0-based global position of first match
+   */
+  size_t mdz_ansi_alg_findSingleSegments(const char* const* ppcSegments, const size_t* pnSegmentSizes, size_t nSegmentsCount, size_t nLeftPos, size_t nRightPos, char cItem, size_t* pnSegment, size_t* pnOffset, enum mdz_error* penError);
+
+  /**
+   * Find first occurrence of pcItems in list of segments (like iovec array of network receive), treated as one logical string. Matches spanning segments are found without copying of segments. Returns 0-based global position of match (if found), or SIZE_MAX if not found or error happened. If penError is not NULL, error will be written there
+   * \param ppcSegments    - array of pointers to segments. Cannot be NULL, pointer can be NULL only if Size of its segment is 0
+   * \param pnSegmentSizes - array of Sizes of segments. Cannot be NULL. Size of segment can be 0
+   * \param nSegmentsCount - number of segments. Cannot be 0
+   * \param nLeftPos       - 0-based global start position to search from left. Use 0 to search from the beginning of logical string
+   * \param nRightPos      - 0-based global end position to search up to. Use total Size-1 to search till the end of logical string
+   * \param pcItems        - items to find. Cannot be NULL
+   * \param nCount         - number of items to find. Cannot be 0
+   * \param pnSegment      - if not NULL, 0-based index of segment containing first item of match is written here
+   * \param pnOffset       - if not NULL, 0-based offset of first item of match inside of its segment is written here
+   * \param penError       - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - ppcSegments is NULL, or pointer of segment with non-zero Size is NULL
+   * MDZ_ERROR_SIZE       - pnSegmentSizes is NULL
+   * MDZ_ERROR_ZERO_SIZE  - nSegmentsCount is 0
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - nRightPos is not less than total Size of segments
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos > nRightPos
+   * MDZ_ERROR_BIG_COUNT  - nCount is bigger than search area (between nLeftPos and nRightPos)
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * SIZE_MAX - if pcItems not found or error happened
+   * Result   - 0-based global position of first match
+   */
+  size_t mdz_ansi_alg_findSegments(const char* const* ppcSegments, const size_t* pnSegmentSizes, size_t nSegmentsCount, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, size_t* pnSegment, size_t* pnOffset, enum mdz_error* penError);
+
+  /**
+   * Counts number of pcItems substring occurences in list of segments (like iovec array of network receive), treated as one logical string. Occurrences spanning segments are counted without copying of segments. If penError is not NULL, error will be written there
+   * \param ppcSegments      - array of pointers to segments. Cannot be NULL, pointer can be NULL only if Size of its segment is 0
+   * \param pnSegmentSizes   - array of Sizes of segments. Cannot be NULL. Size of segment can be 0
+   * \param nSegmentsCount   - number of segments. Cannot be 0
+   * \param nLeftPos         - 0-based global start position to search from left. Use 0 to search from the beginning of logical string
+   * \param nRightPos        - 0-based global end position to search up to. Use total Size-1 to search till the end of logical string
+   * \param pcItems          - items to find. Cannot be NULL
+   * \param nCount           - number of items to find. Cannot be 0
+   * \param bAllowOverlapped - mdz_true if overlapped substrings should be counted, otherwise mdz_false
+   * \param penError         - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - ppcSegments is NULL, or pointer of segment with non-zero Size is NULL
+   * MDZ_ERROR_SIZE       - pnSegmentSizes is NULL
+   * MDZ_ERROR_ZERO_SIZE  - nSegmentsCount is 0
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - nRightPos is not less than total Size of segments
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos > nRightPos
+   * MDZ_ERROR_BIG_COUNT  - nCount is bigger than search area (between nLeftPos and nRightPos)
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * SIZE_MAX - if error happened
+   * Result   - count of substring occurences. 0 if not found
+   */
+  size_t mdz_ansi_alg_countSegments(const char* const* ppcSegments, const size_t* pnSegmentSizes, size_t nSegmentsCount, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, mdz_bool bAllowOverlapped, enum mdz_error* penError);
+
+  /**
+   * \defgroup Buffer functions
+   */
+
+  /**
+   * Prepare string buffer inside of caller-allocated pMemory: returns pointer aligned to MDZ_ANSI_ALG_ALIGNMENT bytes, writes 0-terminator there (empty string) and returns Capacity in pnCapacity (1 byte for 0-terminator and MDZ_ANSI_ALG_PADDING bytes after it are reserved, thus buffer may be used with *Padded functions). Library does not allocate memory itself: for multi-gigabyte data pMemory may be allocated using huge pages (like mmap() with MAP_HUGETLB, or madvise() with MADV_HUGEPAGE on Linux). If penError is not NULL, error will be written there
+   * \param pMemory     - caller-allocated memory. Cannot be NULL
+   * \param nMemorySize - size of pMemory in bytes. Should be enough for alignment, 0-terminator and padding
+   * \param pnCapacity  - Capacity of returned string buffer is written here. Cannot be NULL
+   * \param penError    - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE      - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_BUFFER       - pMemory is NULL
+   * MDZ_ERROR_CAPACITY     - pnCapacity is NULL
+   * MDZ_ERROR_SMALL_BUFFER - nMemorySize is not enough for alignment, 0-terminator and padding
+   * MDZ_ERROR_NONE         - function succeeded
+   * \return:
+   * NULL   - if error happened
+   * Result - pointer to aligned empty string inside of pMemory
+   */
+  char* mdz_ansi_alg_alignBuffer(void* pMemory, size_t nMemorySize, size_t* pnCapacity, enum mdz_error* penError);
+
+  /**
+   * \defgroup Padded functions
+   */
+
+  /**
+   * Find first occurrence of cItem in pcData. Returns 0-based position of match (if found), or SIZE_MAX if not found or error happened. If penError is not NULL, error will be written there
+   * Caller guarantees that MDZ_ANSI_ALG_PADDING bytes after nRightPos are readable, thus kernels may read up to MDZ_ANSI_ALG_PADDING bytes past nRightPos (like full-width SIMD loads without tail processing). Bytes past nRightPos do not influence result
+   * \param pcData    - pointer to string
+   * \param nLeftPos  - 0-based start position to search from left. Use 0 to search from the beginning of string
+   * \param nRightPos - 0-based end position to search up to. Use Size-1 to search till the end of string
+   * \param cItem     - character to find
+   * \param penError  - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE   - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA      - pcData is NULL
+   * MDZ_ERROR_BIG_RIGHT - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT  - nLeftPos > nRightPos
+   * MDZ_ERROR_NONE      - function succeeded
+   * \return:
+   * SIZE_MAX - if cItem not found or error happened
+   * Result   - 0-based position of first match
+   */
+  size_t mdz_ansi_alg_findSinglePadded(const char* pcData, size_t nLeftPos, size_t nRightPos, char cItem, enum mdz_error* penError);
+
+  /**
+   * Find first occurrence of pcItems in pcData using optimized Boyer-Moore-Horspool search. Returns 0-based position of match (if found), or SIZE_MAX if not found or error happened. If penError is not NULL, error will be written there
+   * Caller guarantees that MDZ_ANSI_ALG_PADDING bytes after nRightPos are readable, thus kernels may read up to MDZ_ANSI_ALG_PADDING bytes past nRightPos (like full-width SIMD loads without tail processing). Bytes past nRightPos do not influence result
+   * \param pcData       - pointer to string
+   * \param nLeftPos     - 0-based start position to search from left. Use 0 to search from the beginning of string
+   * \param nRightPos    - 0-based end position to search up to. Use Size-1 to search till the end of string
+   * \param pcItems      - items to find. Cannot be NULL
+   * \param nCount       - number of items to find. Cannot be 0
+   * \param penError     - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos > nRightPos
+   * MDZ_ERROR_BIG_COUNT  - nCount is bigger than search area (between nLeftPos and nRightPos)
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * SIZE_MAX - if pcItems not found or error happened
+   * Result   - 0-based position of first match
+   */
+  size_t mdz_ansi_alg_findPadded(const char* pcData, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, enum mdz_error* penError);
+
+  /**
+   * Find first occurrence of any item of pcItems in string. Returns 0-based position of match (if found), or SIZE_MAX if not found or error happened. If penError is not NULL, error will be written there
+   * Caller guarantees that MDZ_ANSI_ALG_PADDING bytes after nRightPos are readable, thus kernels may read up to MDZ_ANSI_ALG_PADDING bytes past nRightPos (like full-width SIMD loads without tail processing). Bytes past nRightPos do not influence result
+   * \param pcData    - pointer to string
+   * \param nLeftPos  - 0-based start position to search from left. Use 0 to search from the beginning of string
+   * \param nRightPos - 0-based end position to search up to. Use Size-1 to search till the end of string
+   * \param pcItems   - items to find. Cannot be NULL
+   * \param nCount    - number of items to find. Cannot be 0
+   * \param penError  - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_RIGHT  - nRightPos is SIZE_MAX
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos > nRightPos
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * SIZE_MAX - if no item of pcItems found or error happened
+   * Result   - 0-based position of first match
+   */
+  size_t mdz_ansi_alg_firstOfPadded(const char* pcData, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, enum mdz_error* penError);
+
+  /**
+   * Compare content of string with pcItems. If penError is not NULL, error will be written there
+   * Caller guarantees that MDZ_ANSI_ALG_PADDING bytes after compared items of pcData and after pcItems are readable, thus kernels may read up to MDZ_ANSI_ALG_PADDING bytes past them (like full-width SIMD loads without tail processing). Bytes past compared items do not influence result
+   * \param pcData          - pointer to string
+   * \param nDataSize       - Size of pcData
+   * \param nLeftPos        - 0-based start position to compare from left. Use 0 to compare from the beginning of string
+   * \param pcItems         - items to compare. Cannot be NULL
+   * \param nCount          - number of items to compare. Cannot be 0
+   * \param bPartialCompare - if mdz_true compare only nCount items, otherwise compare full strings
+   * \param penError        - if not NULL, error will be written there. There are following errors possible:
+   * \value:
+   * MDZ_ERROR_LICENSE    - license is not initialized using mdz_ansi_alg_init() or invalid
+   * MDZ_ERROR_DATA       - pcData is NULL
+   * MDZ_ERROR_SIZE       - Size is 0 (empty string)
+   * MDZ_ERROR_ITEMS      - pcItems is NULL
+   * MDZ_ERROR_ZERO_COUNT - nCount is 0
+   * MDZ_ERROR_BIG_LEFT   - nLeftPos >= Size
+   * MDZ_ERROR_BIG_COUNT  - nLeftPos + nCount > Size
+   * MDZ_ERROR_NONE       - function succeeded
+   * \return:
+   * MDZ_ANSI_COMPARE_EQUAL or MDZ_ANSI_COMPARE_NONEQUAL - Result of comparison
+   */
+  enum mdz_ansi_compare_result mdz_ansi_alg_comparePadded(const char* pcData, size_t nDataSize, size_t nLeftPos, const char* pcItems, size_t nCount, mdz_bool bPartialCompare, enum mdz_error* penError);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
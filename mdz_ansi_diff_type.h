@@ -0,0 +1,38 @@
+/**
+ * \ingroup mdz libraries
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * mdz ansi diff edit type enum for different mdz libraries
+ *
+ */
+
+#ifndef MDZ_ANSI_DIFF_TYPE_H
+#define MDZ_ANSI_DIFF_TYPE_H
+
+/**
+ * Type of edit script entry
+ */
+enum mdz_ansi_diff_type
+{
+  /**
+   * Lines are equal in both strings
+   */
+  MDZ_ANSI_DIFF_EQUAL = 0,
+
+  /**
+   * Lines are deleted from first string
+   */
+  MDZ_ANSI_DIFF_DELETE /* = 1 */,
+
+  /**
+   * Lines are inserted from second string
+   */
+  MDZ_ANSI_DIFF_INSERT /* = 2 */
+};
+
+#endif
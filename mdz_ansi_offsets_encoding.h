@@ -0,0 +1,33 @@
+/**
+ * \ingroup mdz libraries
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * mdz ansi offsets encoding enum for different mdz libraries
+ *
+ */
+
+#ifndef MDZ_ANSI_OFFSETS_ENCODING_H
+#define MDZ_ANSI_OFFSETS_ENCODING_H
+
+/**
+ * Encoding of ascending offsets arrays. Both encodings start with number of offsets, encoded as variable-length integer, followed by deltas between neighbour offsets (first delta is first offset itself). Empty array is encoded as single 0 byte
+ */
+enum mdz_ansi_offsets_encoding
+{
+  /**
+   * Number of offsets, followed by all deltas encoded as variable-length integers (7 bits per byte, lowest bits first, highest bit set in all bytes except of last)
+   */
+  MDZ_ANSI_OFFSETS_VARINT = 0,
+
+  /**
+   * Number of offsets, followed by blocks of 128 deltas bit-packed with common bit width per block (SIMD-BP128): 1 byte of bit width, then 16 * bit width bytes of packed deltas. Remaining (number of offsets % 128) deltas, which do not fill a block, are encoded as variable-length integers, like in MDZ_ANSI_OFFSETS_VARINT. Number of offsets tells decoder where blocks end and variable-length integers start
+   */
+  MDZ_ANSI_OFFSETS_BP128 /* = 1 */
+};
+
+#endif
@@ -0,0 +1,48 @@
+/**
+ * \ingroup mdz libraries
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * mdz ansi SIMD level enum for different mdz libraries
+ *
+ */
+
+#ifndef MDZ_ANSI_SIMD_H
+#define MDZ_ANSI_SIMD_H
+
+/**
+ * Level of SIMD instructions used by library functions. Every level includes all lower levels. Levels describe binaries of release 0.4 and newer: 0.3 binaries contain no SIMD code
+ */
+enum mdz_ansi_simd
+{
+  /**
+   * No SIMD instructions, portable byte-by-byte code only
+   */
+  MDZ_ANSI_SIMD_NONE = 0,
+
+  /**
+   * No SIMD instructions, portable ANSI C 89/90 SWAR code (processing machine word at a time, using "has zero byte" bit tricks) for findSingle, firstOf with small sets of items, count of single item, compare and trim functions
+   */
+  MDZ_ANSI_SIMD_SWAR /* = 1 */,
+
+  /**
+   * SSE2 instructions (128-bit)
+   */
+  MDZ_ANSI_SIMD_SSE2 /* = 2 */,
+
+  /**
+   * AVX2 instructions (256-bit)
+   */
+  MDZ_ANSI_SIMD_AVX2 /* = 3 */,
+
+  /**
+   * AVX-512 BW/VBMI/VBMI2 instructions (512-bit, masked loads for tails). Short inputs are still processed with 256-bit instructions to avoid CPU frequency throttling
+   */
+  MDZ_ANSI_SIMD_AVX512 /* = 4 */
+};
+
+#endif
@@ -127,7 +127,37 @@ enum mdz_error
   /**
    * Data and Items overlap after replacement
    */
-  MDZ_ERROR_OVERLAP_REPLACE /* = 21 */
+  MDZ_ERROR_OVERLAP_REPLACE /* = 21 */,
+
+  /**
+   * Invalid "table" parameter
+   */
+  MDZ_ERROR_TABLE /* = 22 */,
+
+  /**
+   * Invalid "buffer" parameter
+   */
+  MDZ_ERROR_BUFFER /* = 23 */,
+
+  /**
+   * Items are not sorted or contain duplicates
+   */
+  MDZ_ERROR_ORDER /* = 24 */,
+
+  /**
+   * Not enough buffer size
+   */
+  MDZ_ERROR_SMALL_BUFFER /* = 25 */,
+
+  /**
+   * Invalid chunk size parameters
+   */
+  MDZ_ERROR_CHUNK /* = 26 */,
+
+  /**
+   * Invalid "context" parameter
+   */
+  MDZ_ERROR_CONTEXT /* = 27 */
 
 };
 
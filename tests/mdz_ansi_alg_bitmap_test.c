@@ -0,0 +1,104 @@
+/**
+ * \ingroup mdz_ansi_alg library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Test of bitmap word macros MDZ_ANSI_ALG_BITMAP_LOWEST() and MDZ_ANSI_ALG_BITMAP_LOWEST_PORTABLE() against bit-by-bit scan, for all single bits and pseudo-random words. Macros do not call library, thus test needs neither library binaries nor license.
+ *
+ * Build and run (from this directory):
+ *
+ *   gcc -O2 mdz_ansi_alg_bitmap_test.c -o bitmap_test
+ *   ./bitmap_test
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MDZ_ANSI_ALG_VERSION 4
+#include "../mdz_ansi_alg.h"
+
+static size_t mdz_test_lowest(unsigned long nBits)
+{
+  size_t nIndex = 0;
+
+  while (0 == (nBits & 1UL))
+  {
+    nBits >>= 1;
+    nIndex++;
+  }
+
+  return nIndex;
+}
+
+static int mdz_test_check(unsigned long nBits)
+{
+  size_t nExpected = mdz_test_lowest(nBits);
+
+  if (MDZ_ANSI_ALG_BITMAP_LOWEST(nBits) != nExpected || MDZ_ANSI_ALG_BITMAP_LOWEST_PORTABLE(nBits) != nExpected)
+  {
+    fprintf(stderr, "wrong lowest bit of %lx: expected %lu, got %lu and %lu\n", nBits, (unsigned long) nExpected, (unsigned long) MDZ_ANSI_ALG_BITMAP_LOWEST(nBits), (unsigned long) MDZ_ANSI_ALG_BITMAP_LOWEST_PORTABLE(nBits));
+    return 0;
+  }
+
+  return 1;
+}
+
+int main(void)
+{
+  unsigned long nBitmap[3];
+  unsigned long nBits;
+  unsigned long nRandom = 12345UL;
+  size_t nPositions[4];
+  size_t nFound = 0;
+  size_t i;
+
+  for (i = 0; i < MDZ_ANSI_ALG_BITMAP_WORD_BITS; i++)
+  {
+    if (!mdz_test_check(1UL << i) || !mdz_test_check(~0UL << i))
+      return EXIT_FAILURE;
+  }
+
+  for (i = 0; i < 100000; i++)
+  {
+    nRandom = nRandom * 1103515245UL + 12345UL;
+    nBits = nRandom ^ (nRandom << 13);
+
+    if (0 != nBits && !mdz_test_check(nBits))
+      return EXIT_FAILURE;
+  }
+
+  if (3 != MDZ_ANSI_ALG_BITMAP_WORDS(2 * MDZ_ANSI_ALG_BITMAP_WORD_BITS + 1) || 2 != MDZ_ANSI_ALG_BITMAP_WORDS(2 * MDZ_ANSI_ALG_BITMAP_WORD_BITS))
+  {
+    fprintf(stderr, "wrong MDZ_ANSI_ALG_BITMAP_WORDS\n");
+    return EXIT_FAILURE;
+  }
+
+  nBitmap[0] = 1UL | (1UL << 5);
+  nBitmap[1] = 0;
+  nBitmap[2] = 1UL << (MDZ_ANSI_ALG_BITMAP_WORD_BITS - 1);
+
+  for (i = 0; i < 3; i++)
+  {
+    nBits = nBitmap[i];
+    while (0 != nBits)
+    {
+      nPositions[nFound++] = i * MDZ_ANSI_ALG_BITMAP_WORD_BITS + MDZ_ANSI_ALG_BITMAP_LOWEST(nBits);
+      nBits &= nBits - 1;
+    }
+  }
+
+  if (3 != nFound || 0 != nPositions[0] || 5 != nPositions[1] || 3 * MDZ_ANSI_ALG_BITMAP_WORD_BITS - 1 != nPositions[2])
+  {
+    fprintf(stderr, "wrong iteration of bitmap words\n");
+    return EXIT_FAILURE;
+  }
+
+  printf("bitmap test passed\n");
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+/**
+ * \ingroup mdz_ansi_alg library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Benchmark of mdz_ansi_alg_compare() against memcmp() for string sizes from 1 B to 1 MB. Compared strings are equal except the last byte, thus both functions scan whole string. With MDZ_ANSI_ALG_VERSION 4 (0.4 binaries) mdz_ansi_alg_rcompare() is measured too, on strings which differ only in the first byte.
+ *
+ * Build and run (Linux x64, from this directory):
+ *
+ *   gcc -O2 -DMDZ_TEST_LICENSE='"my_license.h"' mdz_ansi_alg_compare_bench.c -L../Linux/x64 -lmdz_ansi_alg -Wl,-rpath,../Linux/x64 -o compare_bench
+ *   ./compare_bench
+ *
+ * Output is one line per size: size in bytes and throughput in MB/s of each function. Every size is measured on about 256 MB of compared data.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "mdz_test.h"
+
+#define MDZ_BENCH_MAX_SIZE (1024 * 1024)
+#define MDZ_BENCH_TOTAL_SIZE (256.0 * 1024 * 1024)
+
+static double mdz_bench_speed(clock_t nStart, size_t nIterations, size_t nSize)
+{
+  double dSeconds = (double) (clock() - nStart) / CLOCKS_PER_SEC;
+
+  if (dSeconds <= 0)
+    return 0;
+
+  return (double) nIterations * nSize / dSeconds / (1024 * 1024);
+}
+
+int main(void)
+{
+  char* pcA;
+  char* pcB;
+  size_t nSize;
+  size_t nIterations;
+  size_t i;
+  size_t nResult;
+  enum mdz_error enError;
+  clock_t nStart;
+  double dCompare;
+  double dMemcmp;
+
+  if (mdz_false == mdz_test_init())
+    return MDZ_TEST_SKIP;
+
+  pcA = (char*) malloc(MDZ_BENCH_MAX_SIZE);
+  pcB = (char*) malloc(MDZ_BENCH_MAX_SIZE);
+  if (NULL == pcA || NULL == pcB)
+  {
+    fprintf(stderr, "out of memory\n");
+    return EXIT_FAILURE;
+  }
+
+  for (i = 0; i < MDZ_BENCH_MAX_SIZE; i++)
+    pcA[i] = (char) ('a' + i % 26);
+
+#if MDZ_ANSI_ALG_VERSION >= 4
+  printf("%10s %16s %16s %16s\n", "size", "compare MB/s", "memcmp MB/s", "rcompare MB/s");
+#else
+  printf("%10s %16s %16s\n", "size", "compare MB/s", "memcmp MB/s");
+#endif
+
+  for (nSize = 1; nSize <= MDZ_BENCH_MAX_SIZE; nSize *= 4)
+  {
+    nIterations = (size_t) (MDZ_BENCH_TOTAL_SIZE / nSize);
+
+    memcpy(pcB, pcA, nSize);
+    pcB[nSize - 1] = 'Z';
+
+    nResult = 0;
+    nStart = clock();
+    for (i = 0; i < nIterations; i++)
+      nResult += (size_t) mdz_ansi_alg_compare(pcA, nSize, 0, pcB, nSize, mdz_false, &enError);
+    dCompare = mdz_bench_speed(nStart, nIterations, nSize);
+
+    if (MDZ_ERROR_NONE != enError || nIterations * MDZ_ANSI_COMPARE_NONEQUAL != nResult)
+    {
+      fprintf(stderr, "mdz_ansi_alg_compare() failed for size %lu, error %d\n", (unsigned long) nSize, (int) enError);
+      return EXIT_FAILURE;
+    }
+
+    nResult = 0;
+    nStart = clock();
+    for (i = 0; i < nIterations; i++)
+      nResult += (0 != memcmp(pcA, pcB, nSize));
+    dMemcmp = mdz_bench_speed(nStart, nIterations, nSize);
+
+    if (nIterations != nResult)
+    {
+      fprintf(stderr, "memcmp() failed for size %lu\n", (unsigned long) nSize);
+      return EXIT_FAILURE;
+    }
+
+#if MDZ_ANSI_ALG_VERSION >= 4
+    {
+      double dRcompare;
+
+      pcB[nSize - 1] = pcA[nSize - 1];
+      pcB[0] = 'Z';
+
+      nResult = 0;
+      nStart = clock();
+      for (i = 0; i < nIterations; i++)
+        nResult += (size_t) mdz_ansi_alg_rcompare(pcA, nSize, 0, pcB, nSize, mdz_false, &enError);
+      dRcompare = mdz_bench_speed(nStart, nIterations, nSize);
+
+      if (MDZ_ERROR_NONE != enError || nIterations * MDZ_ANSI_COMPARE_NONEQUAL != nResult)
+      {
+        fprintf(stderr, "mdz_ansi_alg_rcompare() failed for size %lu, error %d\n", (unsigned long) nSize, (int) enError);
+        return EXIT_FAILURE;
+      }
+
+      printf("%10lu %16.1f %16.1f %16.1f\n", (unsigned long) nSize, dCompare, dMemcmp, dRcompare);
+    }
+#else
+    printf("%10lu %16.1f %16.1f\n", (unsigned long) nSize, dCompare, dMemcmp);
+#endif
+  }
+
+  free(pcA);
+  free(pcB);
+
+  return EXIT_SUCCESS;
+}
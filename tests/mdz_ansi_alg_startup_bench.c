@@ -0,0 +1,138 @@
+/**
+ * \ingroup mdz_ansi_alg library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Startup benchmark of mdz_ansi_alg for short-lived processes (Linux): time of dlopen() of library, of mdz_ansi_alg_init() and of first mdz_ansi_alg_find() call, and resident memory (RSS) added by loading and initializing library. Every run measures cold start of one process, thus run it several times (like in batch job) and compare results.
+ *
+ * Build and run (Linux x64, from this directory):
+ *
+ *   gcc -O2 -DMDZ_TEST_LICENSE='"my_license.h"' mdz_ansi_alg_startup_bench.c -ldl -o startup_bench
+ *   ./startup_bench ../Linux/x64/libmdz_ansi_alg.so
+ *
+ * Without license only dlopen() and failing mdz_ansi_alg_init() are measured, then benchmark exits with MDZ_TEST_SKIP.
+ *
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <dlfcn.h>
+
+#include "../mdz_ansi_alg.h"
+
+#ifdef MDZ_TEST_LICENSE
+#include MDZ_TEST_LICENSE
+#endif
+
+#define MDZ_TEST_SKIP 77
+
+typedef mdz_bool (*mdz_init_function)(const unsigned long*, const unsigned long*, const unsigned long*, const unsigned long*);
+typedef size_t (*mdz_find_function)(const char*, size_t, size_t, const char*, size_t, enum mdz_error*);
+
+static double mdz_bench_now(void)
+{
+  struct timespec stTime;
+
+  clock_gettime(CLOCK_MONOTONIC, &stTime);
+
+  return stTime.tv_sec * 1e6 + stTime.tv_nsec / 1e3;
+}
+
+static long mdz_bench_rss(void)
+{
+  long nSize = 0;
+  long nResident = 0;
+  FILE* pFile = fopen("/proc/self/statm", "r");
+
+  if (NULL == pFile)
+    return 0;
+
+  if (2 != fscanf(pFile, "%ld %ld", &nSize, &nResident))
+    nResident = 0;
+
+  fclose(pFile);
+
+  return nResident;
+}
+
+int main(int argc, char** argv)
+{
+  static const char pcData[] = "GET /index.html HTTP/1.1";
+  const char* pcLibrary = (argc > 1 ? argv[1] : "../Linux/x64/libmdz_ansi_alg.so");
+  long nPageKb = sysconf(_SC_PAGESIZE) / 1024;
+  long nRssBefore;
+  void* pLibrary;
+  mdz_init_function pInit;
+  mdz_find_function pFind;
+  mdz_bool bInit;
+  size_t nPos;
+  enum mdz_error enError;
+  double dStart;
+  double dOpen;
+  double dInit;
+  double dFind;
+
+  nRssBefore = mdz_bench_rss();
+
+  dStart = mdz_bench_now();
+  pLibrary = dlopen(pcLibrary, RTLD_NOW);
+  dOpen = mdz_bench_now() - dStart;
+
+  if (NULL == pLibrary)
+  {
+    fprintf(stderr, "dlopen() failed: %s\n", dlerror());
+    return EXIT_FAILURE;
+  }
+
+  *(void**) &pInit = dlsym(pLibrary, "mdz_ansi_alg_init");
+  *(void**) &pFind = dlsym(pLibrary, "mdz_ansi_alg_find");
+  if (NULL == pInit || NULL == pFind)
+  {
+    fprintf(stderr, "dlsym() failed: %s\n", dlerror());
+    return EXIT_FAILURE;
+  }
+
+  dStart = mdz_bench_now();
+#ifdef MDZ_TEST_LICENSE
+  bInit = pInit(pnFirstNameHash, pnLastNameHash, pnEmailHash, pnLicenseHash);
+#else
+  bInit = pInit(NULL, NULL, NULL, NULL);
+#endif
+  dInit = mdz_bench_now() - dStart;
+
+  printf("dlopen:     %10.1f us\n", dOpen);
+  printf("init:       %10.1f us\n", dInit);
+
+  if (mdz_false == bInit)
+  {
+    printf("added RSS:  %10ld KB\n", (mdz_bench_rss() - nRssBefore) * nPageKb);
+    fprintf(stderr, "mdz_ansi_alg_init() failed: no valid test-license, first find is not measured\n");
+    return MDZ_TEST_SKIP;
+  }
+
+  dStart = mdz_bench_now();
+  nPos = pFind(pcData, 0, sizeof(pcData) - 2, "HTTP", 4, &enError);
+  dFind = mdz_bench_now() - dStart;
+
+  if (MDZ_ERROR_NONE != enError || 16 != nPos)
+  {
+    fprintf(stderr, "mdz_ansi_alg_find() failed, error %d\n", (int) enError);
+    return EXIT_FAILURE;
+  }
+
+  printf("first find: %10.1f us\n", dFind);
+  printf("total:      %10.1f us\n", dOpen + dInit + dFind);
+  printf("added RSS:  %10ld KB\n", (mdz_bench_rss() - nRssBefore) * nPageKb);
+
+  dlclose(pLibrary);
+
+  return EXIT_SUCCESS;
+}
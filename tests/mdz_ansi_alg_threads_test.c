@@ -0,0 +1,279 @@
+/**
+ * \ingroup mdz_ansi_alg library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Multi-threaded stress and scaling test of mdz_ansi_alg (POSIX threads). All 19 functions of 0.3 binaries are called concurrently and every result is checked:
+ * - read-only functions (findSingle, rfindSingle, find, rfind, count, firstOf, firstNotOf, lastOf, lastNotOf, compare) search the same shared 96 MB string, every call on area of 48 MB (below 90000000 bytes, thus without locking). compare compares shared string with its separate copy;
+ * - writing functions (insert, removeFrom, remove, trimLeft, trimRight, trim, replace, reverse) modify 1 MB string buffer of every thread.
+ * Scaling part runs with 1, 2, 4 ... threads up to number of CPUs (at most 64) and prints throughput of read-only functions (bytes actually scanned by them) and speedup, which should grow linearly with number of threads. Writing functions run in the same loop but are not counted in throughput.
+ * After scaling part, calls on area bigger than 90000000 bytes are checked from all threads, serialized with mutex as described in "thread-safety" of mdz_ansi_alg.h. This check is not timed.
+ *
+ * Build and run (Linux x64, from this directory):
+ *
+ *   gcc -O2 -DMDZ_TEST_LICENSE='"my_license.h"' mdz_ansi_alg_threads_test.c -L../Linux/x64 -lmdz_ansi_alg -Wl,-rpath,../Linux/x64 -lpthread -o threads_test
+ *   ./threads_test
+ *
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "mdz_test.h"
+
+#define MDZ_TEST_SIZE (96 * 1024 * 1024)
+#define MDZ_TEST_HALF (MDZ_TEST_SIZE / 2)
+#define MDZ_TEST_ROUNDS 8
+#define MDZ_TEST_MAX_THREADS 64
+#define MDZ_TEST_BUFFER_SIZE (1024 * 1024)
+#define MDZ_TEST_BUFFER_CAPACITY (MDZ_TEST_BUFFER_SIZE + 64)
+#define MDZ_TEST_NOT_FOUND ((size_t) -1)
+
+static char* g_pcData;
+static char* g_pcCopy;
+static size_t g_nNeedlePos;
+static size_t g_nMarkPos;
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static const char g_pcNeedle[] = "needle";
+static const char g_pcMarks[] = "#$%&*+";
+static const char g_pcLetters[] = "abcdefghijklmnopqrstuvwxyz";
+
+/**
+ * Number of bytes scanned by read-only functions in one round of mdz_test_search()
+ */
+static size_t mdz_test_scanned(void)
+{
+  return 9 * (size_t) MDZ_TEST_HALF + (g_nNeedlePos + sizeof(g_pcNeedle) - 1 - MDZ_TEST_HALF);
+}
+
+static int mdz_test_search(void)
+{
+  enum mdz_error enError;
+
+  if (MDZ_TEST_NOT_FOUND != mdz_ansi_alg_findSingle(g_pcData, 0, MDZ_TEST_HALF - 1, '#', &enError) || MDZ_ERROR_NONE != enError)
+    return 0;
+
+  if (MDZ_TEST_NOT_FOUND != mdz_ansi_alg_rfindSingle(g_pcData, 0, MDZ_TEST_HALF - 1, '#', &enError) || MDZ_ERROR_NONE != enError)
+    return 0;
+
+  if (g_nNeedlePos != mdz_ansi_alg_find(g_pcData, MDZ_TEST_HALF, MDZ_TEST_SIZE - 1, g_pcNeedle, sizeof(g_pcNeedle) - 1, &enError) || MDZ_ERROR_NONE != enError)
+    return 0;
+
+  if (MDZ_TEST_NOT_FOUND != mdz_ansi_alg_rfind(g_pcData, 0, MDZ_TEST_HALF - 1, g_pcNeedle, sizeof(g_pcNeedle) - 1, &enError) || MDZ_ERROR_NONE != enError)
+    return 0;
+
+  if (0 != mdz_ansi_alg_count(g_pcData, 0, MDZ_TEST_HALF - 1, "#", 1, mdz_false, mdz_true, &enError) || MDZ_ERROR_NONE != enError)
+    return 0;
+
+  if (MDZ_TEST_NOT_FOUND != mdz_ansi_alg_firstOf(g_pcData, 0, MDZ_TEST_HALF - 1, g_pcMarks, sizeof(g_pcMarks) - 1, &enError) || MDZ_ERROR_NONE != enError)
+    return 0;
+
+  if (MDZ_TEST_NOT_FOUND != mdz_ansi_alg_firstNotOf(g_pcData, 0, MDZ_TEST_HALF - 1, g_pcLetters, sizeof(g_pcLetters) - 1, &enError) || MDZ_ERROR_NONE != enError)
+    return 0;
+
+  if (MDZ_TEST_NOT_FOUND != mdz_ansi_alg_lastOf(g_pcData, 0, MDZ_TEST_HALF - 1, g_pcMarks, sizeof(g_pcMarks) - 1, &enError) || MDZ_ERROR_NONE != enError)
+    return 0;
+
+  if (MDZ_TEST_NOT_FOUND != mdz_ansi_alg_lastNotOf(g_pcData, 0, MDZ_TEST_HALF - 1, g_pcLetters, sizeof(g_pcLetters) - 1, &enError) || MDZ_ERROR_NONE != enError)
+    return 0;
+
+  if (MDZ_ANSI_COMPARE_EQUAL != mdz_ansi_alg_compare(g_pcData, MDZ_TEST_HALF, 0, g_pcCopy, MDZ_TEST_HALF, mdz_false, &enError) || MDZ_ERROR_NONE != enError)
+    return 0;
+
+  return 1;
+}
+
+static int mdz_test_modify(char* pcBuffer)
+{
+  size_t nSize = MDZ_TEST_BUFFER_SIZE + 8;
+  size_t nReplaced = (MDZ_TEST_BUFFER_SIZE - 3) / 26 + 1;
+  char cLast;
+  enum mdz_error enError;
+
+  memset(pcBuffer, ' ', 4);
+  memcpy(pcBuffer + 4, g_pcData, MDZ_TEST_BUFFER_SIZE);
+  memset(pcBuffer + 4 + MDZ_TEST_BUFFER_SIZE, ' ', 4);
+  pcBuffer[nSize] = '\0';
+
+  if (MDZ_ERROR_NONE != mdz_ansi_alg_trimLeft(pcBuffer, &nSize, 0, nSize - 1, " ", 1) || MDZ_TEST_BUFFER_SIZE + 4 != nSize)
+    return 0;
+
+  if (MDZ_ERROR_NONE != mdz_ansi_alg_trimRight(pcBuffer, &nSize, 0, nSize - 1, " ", 1) || MDZ_TEST_BUFFER_SIZE != nSize)
+    return 0;
+
+  if (MDZ_ERROR_NONE != mdz_ansi_alg_insert(pcBuffer, &nSize, MDZ_TEST_BUFFER_CAPACITY, 0, "  ", 2) ||
+      MDZ_ERROR_NONE != mdz_ansi_alg_insert(pcBuffer, &nSize, MDZ_TEST_BUFFER_CAPACITY, nSize, "  ", 2) ||
+      MDZ_TEST_BUFFER_SIZE + 4 != nSize)
+    return 0;
+
+  if (MDZ_ERROR_NONE != mdz_ansi_alg_trim(pcBuffer, &nSize, 0, nSize - 1, " ", 1) || MDZ_TEST_BUFFER_SIZE != nSize || 0 != memcmp(pcBuffer, g_pcData, MDZ_TEST_BUFFER_SIZE))
+    return 0;
+
+  if (MDZ_ERROR_NONE != mdz_ansi_alg_replace(pcBuffer, &nSize, MDZ_TEST_BUFFER_CAPACITY, 0, nSize - 1, "abc", 3, "ABC", 3, mdz_true, MDZ_ANSI_REPLACE_DUAL, NULL) || MDZ_TEST_BUFFER_SIZE != nSize)
+    return 0;
+
+  if (nReplaced != mdz_ansi_alg_count(pcBuffer, 0, nSize - 1, "ABC", 3, mdz_false, mdz_true, &enError) || MDZ_ERROR_NONE != enError)
+    return 0;
+
+  if (MDZ_ERROR_NONE != mdz_ansi_alg_remove(pcBuffer, &nSize, 0, nSize - 1, "ABC", 3, mdz_true) || MDZ_TEST_BUFFER_SIZE - 3 * nReplaced != nSize || 'd' != pcBuffer[0])
+    return 0;
+
+  if (MDZ_ERROR_NONE != mdz_ansi_alg_removeFrom(pcBuffer, &nSize, 0, 1) || MDZ_TEST_BUFFER_SIZE - 3 * nReplaced - 1 != nSize || 'e' != pcBuffer[0])
+    return 0;
+
+  cLast = pcBuffer[nSize - 1];
+
+  if (MDZ_ERROR_NONE != mdz_ansi_alg_reverse(pcBuffer, 0, nSize - 1) || cLast != pcBuffer[0] || 'e' != pcBuffer[nSize - 1])
+    return 0;
+
+  if (MDZ_ERROR_NONE != mdz_ansi_alg_reverse(pcBuffer, 0, nSize - 1) || 'e' != pcBuffer[0] || cLast != pcBuffer[nSize - 1])
+    return 0;
+
+  return 1;
+}
+
+static void* mdz_test_scaling_thread(void* pResult)
+{
+  char* pcBuffer = (char*) malloc(MDZ_TEST_BUFFER_CAPACITY + 1);
+  size_t nRound;
+  int bResult = (NULL != pcBuffer);
+
+  for (nRound = 0; bResult && nRound < MDZ_TEST_ROUNDS; nRound++)
+    bResult = mdz_test_search() && mdz_test_modify(pcBuffer);
+
+  free(pcBuffer);
+
+  *(int*) pResult = bResult;
+  return NULL;
+}
+
+static void* mdz_test_serialized_thread(void* pResult)
+{
+  size_t nCount;
+  size_t nPos;
+  enum mdz_error enCountError;
+  enum mdz_error enPosError;
+
+  pthread_mutex_lock(&g_mutex);
+  nCount = mdz_ansi_alg_count(g_pcData, 0, MDZ_TEST_SIZE - 1, "#", 1, mdz_false, mdz_true, &enCountError);
+  nPos = mdz_ansi_alg_firstOf(g_pcData, 0, MDZ_TEST_SIZE - 1, g_pcMarks, sizeof(g_pcMarks) - 1, &enPosError);
+  pthread_mutex_unlock(&g_mutex);
+
+  *(int*) pResult = (MDZ_ERROR_NONE == enCountError && 1 == nCount && MDZ_ERROR_NONE == enPosError && g_nMarkPos == nPos);
+  return NULL;
+}
+
+static int mdz_test_threads(size_t nThreads, void* (*pFunction)(void*))
+{
+  pthread_t pThreads[MDZ_TEST_MAX_THREADS];
+  int pnResults[MDZ_TEST_MAX_THREADS];
+  size_t i;
+
+  for (i = 0; i < nThreads; i++)
+  {
+    if (0 != pthread_create(&pThreads[i], NULL, pFunction, &pnResults[i]))
+    {
+      fprintf(stderr, "pthread_create() failed\n");
+      return 0;
+    }
+  }
+
+  for (i = 0; i < nThreads; i++)
+    pthread_join(pThreads[i], NULL);
+
+  for (i = 0; i < nThreads; i++)
+  {
+    if (0 == pnResults[i])
+    {
+      fprintf(stderr, "wrong result in thread %lu of %lu\n", (unsigned long) i, (unsigned long) nThreads);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static double mdz_test_now(void)
+{
+  struct timespec stTime;
+
+  clock_gettime(CLOCK_MONOTONIC, &stTime);
+
+  return stTime.tv_sec + stTime.tv_nsec / 1e9;
+}
+
+int main(void)
+{
+  long nCpus;
+  size_t nThreads;
+  size_t i;
+  double dStart;
+  double dSeconds;
+  double dBase = 0;
+
+  if (mdz_false == mdz_test_init())
+    return MDZ_TEST_SKIP;
+
+  g_pcData = (char*) malloc(MDZ_TEST_SIZE + 1);
+  g_pcCopy = (char*) malloc(MDZ_TEST_HALF);
+  if (NULL == g_pcData || NULL == g_pcCopy)
+  {
+    fprintf(stderr, "out of memory\n");
+    return EXIT_FAILURE;
+  }
+
+  for (i = 0; i < MDZ_TEST_SIZE; i++)
+    g_pcData[i] = (char) ('a' + i % 26);
+  g_pcData[MDZ_TEST_SIZE] = '\0';
+
+  g_nNeedlePos = MDZ_TEST_SIZE - 100;
+  memcpy(g_pcData + g_nNeedlePos, g_pcNeedle, sizeof(g_pcNeedle) - 1);
+
+  g_nMarkPos = MDZ_TEST_SIZE - 3;
+  g_pcData[g_nMarkPos] = '#';
+
+  memcpy(g_pcCopy, g_pcData, MDZ_TEST_HALF);
+
+  nCpus = sysconf(_SC_NPROCESSORS_ONLN);
+  if (nCpus < 1)
+    nCpus = 1;
+  if (nCpus > MDZ_TEST_MAX_THREADS)
+    nCpus = MDZ_TEST_MAX_THREADS;
+
+  printf("%8s %12s %12s\n", "threads", "GB/s", "speedup");
+
+  for (nThreads = 1; nThreads <= (size_t) nCpus; nThreads *= 2)
+  {
+    dStart = mdz_test_now();
+
+    if (0 == mdz_test_threads(nThreads, mdz_test_scaling_thread))
+      return EXIT_FAILURE;
+
+    dSeconds = mdz_test_now() - dStart;
+
+    if (1 == nThreads)
+      dBase = dSeconds;
+
+    printf("%8lu %12.2f %12.2f\n", (unsigned long) nThreads, (double) mdz_test_scanned() * MDZ_TEST_ROUNDS * nThreads / dSeconds / 1e9, dBase * nThreads / dSeconds);
+  }
+
+  if (0 == mdz_test_threads((size_t) nCpus, mdz_test_serialized_thread))
+    return EXIT_FAILURE;
+
+  printf("serialized calls on %lu bytes from %ld threads: passed\n", (unsigned long) MDZ_TEST_SIZE, nCpus);
+
+  free(g_pcData);
+  free(g_pcCopy);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,57 @@
+/**
+ * \ingroup mdz_ansi_alg library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Common helpers of mdz_ansi_alg tests and benchmarks.
+ *
+ * Library functions work only after initialization with valid license (please refer to "mdz_ansi_alg Usage" in README.md). Put your test-license data into header file like:
+ *
+ *   static const unsigned long pnFirstNameHash[] = { ... };
+ *   static const unsigned long pnLastNameHash[] = { ... };
+ *   static const unsigned long pnEmailHash[] = { ... };
+ *   static const unsigned long pnLicenseHash[] = { ... };
+ *
+ * and pass its name to compiler: -DMDZ_TEST_LICENSE='"my_license.h"'. Without license tests are skipped with exit code MDZ_TEST_SKIP.
+ *
+ */
+
+#ifndef MDZ_TEST_H
+#define MDZ_TEST_H
+
+#include <stdio.h>
+
+#include "../mdz_ansi_alg.h"
+
+#ifdef MDZ_TEST_LICENSE
+#include MDZ_TEST_LICENSE
+#endif
+
+/**
+ * Exit code of skipped test
+ */
+#define MDZ_TEST_SKIP 77
+
+/**
+ * Initializes library with test-license. Returns mdz_false if there is no license or initialization failed
+ */
+static mdz_bool mdz_test_init(void)
+{
+#ifdef MDZ_TEST_LICENSE
+  if (mdz_false == mdz_ansi_alg_init(pnFirstNameHash, pnLastNameHash, pnEmailHash, pnLicenseHash))
+  {
+    fprintf(stderr, "mdz_ansi_alg_init() failed: license is invalid or expired\n");
+    return mdz_false;
+  }
+  return mdz_true;
+#else
+  fprintf(stderr, "no test-license: compile with -DMDZ_TEST_LICENSE='\"my_license.h\"'\n");
+  return mdz_false;
+#endif
+}
+
+#endif